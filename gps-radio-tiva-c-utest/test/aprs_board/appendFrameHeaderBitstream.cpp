@@ -0,0 +1,83 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_appendFrameHeaderBitstream)
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            initializeFrameHeaderCache(&CALLSIGN_SOURCE, &headerCache);
+        }
+
+        TEST_METHOD(Should_match_encoding_flags_and_header_for_every_bit_position_and_last_bit)
+        {
+            for (uint8_t leadingBits = 0; leadingBits < 16; ++leadingBits)
+            {
+                for (uint8_t lastBit = 0; lastBit < 2; ++lastBit)
+                {
+                    uint8_t expectedBitstream[BUFFER_SIZE] = { 0 };
+                    uint8_t bitstream[BUFFER_SIZE] = { 0 };
+
+                    // previous frame leaves arbitrary bits and arbitrary number of ones behind
+                    EncodingData expectedEncodingData = { 0 };
+                    expectedEncodingData.lastBit = lastBit;
+                    expectedEncodingData.numberOfOnes = 3;
+                    expectedEncodingData.bitstreamSize.bitstreamCharIdx = leadingBits / 8;
+                    expectedEncodingData.bitstreamSize.bitstreamCharBitIdx = leadingBits % 8;
+                    expectedBitstream[0] = 0xA5;
+                    bitstream[0] = 0xA5;
+
+                    EncodingData encodingData = expectedEncodingData;
+
+                    for (uint8_t i = 0; i < PREFIX_FLAGS_COUNT; ++i)
+                    {
+                        Assert::IsTrue(encodeAndAppendBits(expectedBitstream, BUFFER_SIZE, &expectedEncodingData, (const uint8_t*) "\x7E", 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
+                    }
+                    Assert::IsTrue(encodeAndAppendBits(expectedBitstream, BUFFER_SIZE, &expectedEncodingData, headerCache.header, AX25_HEADER_LEN, ST_PERFORM_STUFFING, SHIFT_ONE_LEFT_NO));
+
+                    Assert::IsTrue(appendFrameHeaderBitstream(&headerCache, bitstream, BUFFER_SIZE, &encodingData));
+
+                    Assert::AreEqual(expectedEncodingData.lastBit, encodingData.lastBit);
+                    Assert::AreEqual(expectedEncodingData.numberOfOnes, encodingData.numberOfOnes);
+                    Assert::AreEqual(expectedEncodingData.bitstreamSize.bitstreamCharIdx, encodingData.bitstreamSize.bitstreamCharIdx);
+                    Assert::AreEqual(expectedEncodingData.bitstreamSize.bitstreamCharBitIdx, encodingData.bitstreamSize.bitstreamCharBitIdx);
+
+                    // bits past the end of bitstream don't matter
+                    const uint16_t fullBytes = encodingData.bitstreamSize.bitstreamCharIdx;
+                    const uint8_t lastByteMask = (1 << encodingData.bitstreamSize.bitstreamCharBitIdx) - 1;
+                    Assert::AreEqual(0, memcmp(expectedBitstream, bitstream, fullBytes));
+                    Assert::AreEqual((uint8_t) (expectedBitstream[fullBytes] & lastByteMask), (uint8_t) (bitstream[fullBytes] & lastByteMask));
+                }
+            }
+        }
+
+        TEST_METHOD(Should_return_false_if_there_is_not_enough_space)
+        {
+            uint8_t bitstream[BUFFER_SIZE] = { 0 };
+            EncodingData encodingData = { 0 };
+            encodingData.lastBit = 1;
+
+            const BitstreamPos headerSize = headerCache.encodingData.bitstreamSize;
+            const uint16_t headerLen = headerSize.bitstreamCharIdx + (headerSize.bitstreamCharBitIdx ? 1 : 0);
+
+            Assert::IsFalse(appendFrameHeaderBitstream(&headerCache, bitstream, headerLen - 1, &encodingData));
+            Assert::IsTrue(appendFrameHeaderBitstream(&headerCache, bitstream, headerLen, &encodingData));
+        }
+
+        TEST_METHOD(Should_return_false_if_any_of_pointers_is_nullptr)
+        {
+            uint8_t bitstream[BUFFER_SIZE] = { 0 };
+            EncodingData encodingData = { 0 };
+
+            Assert::IsFalse(appendFrameHeaderBitstream(nullptr, bitstream, BUFFER_SIZE, &encodingData));
+            Assert::IsFalse(appendFrameHeaderBitstream(&headerCache, nullptr, BUFFER_SIZE, &encodingData));
+            Assert::IsFalse(appendFrameHeaderBitstream(&headerCache, bitstream, BUFFER_SIZE, nullptr));
+        }
+
+        static const uint16_t BUFFER_SIZE = 64;
+
+        FrameHeaderCache headerCache;
+    };
+}
@@ -0,0 +1,36 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_compressedLatitude)
+    {
+        uint32_t CompressedLatitude(uint8_t degrees, fixedPointW2F6_t minutes, HEMISPHERE hemisphere)
+        {
+            AngularCoordinate latitude = { true, degrees, minutes, hemisphere };
+            return compressedLatitude(&latitude);
+        }
+
+        TEST_METHOD(Should_match_aprs_specification_example)
+        {
+            uint8_t buffer[4];
+
+            encodeBase91(CompressedLatitude(49, 30000000, H_NORTH), buffer, 4);
+            Assert::AreEqual(0, memcmp("5L!!", buffer, 4));
+        }
+
+        TEST_METHOD(Should_count_from_north_pole)
+        {
+            Assert::AreEqual((uint32_t) 0, CompressedLatitude(90, 0, H_NORTH));
+            Assert::AreEqual((uint32_t) COMPRESSED_LATITUDE_SCALE * 90, CompressedLatitude(0, 0, H_NORTH));
+            Assert::AreEqual((uint32_t) COMPRESSED_LATITUDE_SCALE * 180, CompressedLatitude(90, 0, H_SOUTH));
+        }
+
+        TEST_METHOD(Should_use_minutes)
+        {
+            Assert::AreEqual((uint32_t) COMPRESSED_LATITUDE_SCALE * 90 - COMPRESSED_LATITUDE_SCALE / 2, CompressedLatitude(0, 30000000, H_NORTH));
+            Assert::AreEqual((uint32_t) COMPRESSED_LATITUDE_SCALE * 90 + COMPRESSED_LATITUDE_SCALE / 2, CompressedLatitude(0, 30000000, H_SOUTH));
+        }
+    };
+}
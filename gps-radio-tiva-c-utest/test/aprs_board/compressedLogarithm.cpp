@@ -0,0 +1,41 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_compressedLogarithm)
+    {
+        TEST_METHOD(Should_match_aprs_specification_altitude_example)
+        {
+            // 10004 feet is cs "S]"
+            Assert::AreEqual((uint16_t) (('S' - '!') * 91 + (']' - '!')), compressedLogarithm(10004.0f, COMPRESSED_ALTITUDE_POWERS, COMPRESSED_ALTITUDE_POWERS_COUNT, BASE91_MAX_2_CHARS_VALUE));
+        }
+
+        TEST_METHOD(Should_match_aprs_specification_speed_example)
+        {
+            // 36.2 knots is s "P"
+            Assert::AreEqual((uint16_t) ('P' - '!'), compressedLogarithm(36.2f + 1.0f, COMPRESSED_SPEED_POWERS, COMPRESSED_SPEED_POWERS_COUNT, COMPRESSED_MAX_COURSE_SPEED_VALUE));
+        }
+
+        TEST_METHOD(Should_round_to_nearest_power)
+        {
+            Assert::AreEqual((uint16_t) 1, compressedLogarithm(1.08f, COMPRESSED_SPEED_POWERS, COMPRESSED_SPEED_POWERS_COUNT, COMPRESSED_MAX_COURSE_SPEED_VALUE));
+            Assert::AreEqual((uint16_t) 1, compressedLogarithm(1.12f, COMPRESSED_SPEED_POWERS, COMPRESSED_SPEED_POWERS_COUNT, COMPRESSED_MAX_COURSE_SPEED_VALUE));
+            Assert::AreEqual((uint16_t) 2, compressedLogarithm(1.13f, COMPRESSED_SPEED_POWERS, COMPRESSED_SPEED_POWERS_COUNT, COMPRESSED_MAX_COURSE_SPEED_VALUE));
+        }
+
+        TEST_METHOD(Should_return_0_for_values_up_to_1)
+        {
+            Assert::AreEqual((uint16_t) 0, compressedLogarithm(-5.0f, COMPRESSED_ALTITUDE_POWERS, COMPRESSED_ALTITUDE_POWERS_COUNT, BASE91_MAX_2_CHARS_VALUE));
+            Assert::AreEqual((uint16_t) 0, compressedLogarithm(0.0f, COMPRESSED_ALTITUDE_POWERS, COMPRESSED_ALTITUDE_POWERS_COUNT, BASE91_MAX_2_CHARS_VALUE));
+            Assert::AreEqual((uint16_t) 0, compressedLogarithm(1.0f, COMPRESSED_ALTITUDE_POWERS, COMPRESSED_ALTITUDE_POWERS_COUNT, BASE91_MAX_2_CHARS_VALUE));
+        }
+
+        TEST_METHOD(Should_limit_result)
+        {
+            Assert::AreEqual((uint16_t) COMPRESSED_MAX_COURSE_SPEED_VALUE, compressedLogarithm(100000.0f, COMPRESSED_SPEED_POWERS, COMPRESSED_SPEED_POWERS_COUNT, COMPRESSED_MAX_COURSE_SPEED_VALUE));
+            Assert::AreEqual((uint16_t) BASE91_MAX_2_CHARS_VALUE, compressedLogarithm(1.0e9f, COMPRESSED_ALTITUDE_POWERS, COMPRESSED_ALTITUDE_POWERS_COUNT, BASE91_MAX_2_CHARS_VALUE));
+        }
+    };
+}
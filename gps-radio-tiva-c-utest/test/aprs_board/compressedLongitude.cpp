@@ -0,0 +1,36 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_compressedLongitude)
+    {
+        uint32_t CompressedLongitude(uint8_t degrees, fixedPointW2F6_t minutes, HEMISPHERE hemisphere)
+        {
+            AngularCoordinate longitude = { true, degrees, minutes, hemisphere };
+            return compressedLongitude(&longitude);
+        }
+
+        TEST_METHOD(Should_match_aprs_specification_example)
+        {
+            uint8_t buffer[4];
+
+            encodeBase91(CompressedLongitude(72, 45000000, H_WEST), buffer, 4);
+            Assert::AreEqual(0, memcmp("<*e7", buffer, 4));
+        }
+
+        TEST_METHOD(Should_count_from_180_west)
+        {
+            Assert::AreEqual((uint32_t) 0, CompressedLongitude(180, 0, H_WEST));
+            Assert::AreEqual((uint32_t) COMPRESSED_LONGITUDE_SCALE * 180, CompressedLongitude(0, 0, H_EAST));
+            Assert::AreEqual((uint32_t) COMPRESSED_LONGITUDE_SCALE * 360, CompressedLongitude(180, 0, H_EAST));
+        }
+
+        TEST_METHOD(Should_use_minutes)
+        {
+            Assert::AreEqual((uint32_t) COMPRESSED_LONGITUDE_SCALE * 361 / 2, CompressedLongitude(0, 30000000, H_EAST));
+            Assert::AreEqual((uint32_t) COMPRESSED_LONGITUDE_SCALE * 359 / 2, CompressedLongitude(0, 30000000, H_WEST));
+        }
+    };
+}
@@ -0,0 +1,98 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_createCompressedPacketPayload)
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            gpsData.isValid = true;
+
+            gpsData.gpggaData.utcTime.isValid = true;
+            gpsData.gpggaData.utcTime.hours = 12;
+            gpsData.gpggaData.utcTime.minutes = 17;
+            gpsData.gpggaData.utcTime.seconds = 3344;
+
+            gpsData.gpggaData.latitude.isValid = true;
+            gpsData.gpggaData.latitude.hemisphere = H_NORTH;
+            gpsData.gpggaData.latitude.degrees = 10;
+            gpsData.gpggaData.latitude.minutes = 17224400;
+
+            gpsData.gpggaData.longitude.isValid = true;
+            gpsData.gpggaData.longitude.hemisphere = H_EAST;
+            gpsData.gpggaData.longitude.degrees = 173;
+            gpsData.gpggaData.longitude.minutes = 49246400;
+
+            gpsData.gpggaData.fixType = GPSFT_GPS;
+            gpsData.gpggaData.numberOfSattelitesInUse = 14;
+            gpsData.gpggaData.altitudeMslMeters = 1900;
+
+            gpsData.gpvtgData.speedKph = 130;
+            gpsData.gpvtgData.trueCourseDegrees = 180;
+
+            telemetry.cpuTemperature = 1700;
+            telemetry.voltage = 900;
+
+            gpsDataSource = GPS_ID_VENUS;
+
+            memset(buffer, 0, BUFFER_SIZE);
+        }
+
+        void AssertAreEqual(const char* pExpectedBuffer, APRS_PAYLOAD_FORMAT payloadFormat = APF_COMPRESSED_ALTITUDE, uint16_t messageIdx = 11)
+        {
+            const uint8_t expectedSize = (uint8_t) strlen(pExpectedBuffer);
+
+            Assert::AreEqual(expectedSize, createCompressedPacketPayload(payloadFormat, gpsDataSource, &gpsData, &telemetry, messageIdx, buffer, BUFFER_SIZE));
+            Assert::AreEqual(0, memcmp(pExpectedBuffer, buffer, expectedSize));
+        }
+
+        TEST_METHOD(Should_format_message_with_altitude)
+        {
+            AssertAreEqual("@121733z/I;i=zGpp>DES|!,!\"\"p!{!4|");
+        }
+
+        TEST_METHOD(Should_format_message_with_course_and_speed)
+        {
+            AssertAreEqual("@121733z/I;i=zGpp>%<C|!,!\"\"p!{!4|", APF_COMPRESSED_COURSE_SPEED);
+        }
+
+        TEST_METHOD(Should_format_message_without_time)
+        {
+            gpsData.gpggaData.utcTime.isValid = false;
+
+            AssertAreEqual("!/I;i=zGpp>DES|!,!\"\"p!{!4|");
+        }
+
+        TEST_METHOD(Should_fall_back_to_uncompressed_telemetry_without_position)
+        {
+            gpsData.gpggaData.latitude.isValid = false;
+
+            AssertAreEqual("T#011,001,170,090,000,000,00000000 a=00190");
+        }
+
+        TEST_METHOD(Should_wrap_sequence_and_limit_telemetry_values)
+        {
+            telemetry.voltage = 1000000;
+            AssertAreEqual("@121733z/I;i=zGpp>DES|!!!\"\"p{{!4|", APF_COMPRESSED_ALTITUDE, 91 * 91);
+        }
+
+        TEST_METHOD(Should_return_0_if_there_is_not_enough_space)
+        {
+            const uint8_t expectedSize = (uint8_t) strlen("@121733z/I;i=zGpp>DES|!,!\"\"p!{!4|");
+
+            for (uint8_t i = 0; i < expectedSize; ++i)
+            {
+                Assert::AreEqual((uint8_t) 0, createCompressedPacketPayload(APF_COMPRESSED_ALTITUDE, gpsDataSource, &gpsData, &telemetry, 11, buffer, i));
+            }
+        }
+
+        static const uint8_t BUFFER_SIZE = 255;
+
+        GpsData gpsData;
+        Telemetry telemetry;
+        GpsDataSource gpsDataSource;
+        uint8_t buffer[BUFFER_SIZE];
+    };
+}
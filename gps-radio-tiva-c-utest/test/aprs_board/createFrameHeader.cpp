@@ -0,0 +1,42 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_createFrameHeader)
+    {
+        TEST_METHOD(Should_create_header_with_shifted_callsigns_ssids_control_and_pid)
+        {
+            const uint8_t expectedHeader[AX25_HEADER_LEN] =
+            {
+                'W' << 1, 'I' << 1, 'D' << 1, 'E' << 1, '1' << 1, ' ' << 1, 0xE2,
+                'H' << 1, 'A' << 1, 'B' << 1, 'H' << 1, 'A' << 1, 'B' << 1, 0xF6,
+                'W' << 1, 'I' << 1, 'D' << 1, 'E' << 1, '2' << 1, ' ' << 1, 0xE5,
+                0x03, 0xF0,
+            };
+            uint8_t buffer[AX25_HEADER_LEN];
+
+            Assert::AreEqual((uint8_t) AX25_HEADER_LEN, createFrameHeader(&CALLSIGN_SOURCE, buffer, AX25_HEADER_LEN));
+            Assert::AreEqual(0, memcmp(expectedHeader, buffer, AX25_HEADER_LEN));
+        }
+
+        TEST_METHOD(Should_return_0_if_there_is_not_enough_space)
+        {
+            uint8_t buffer[AX25_HEADER_LEN];
+
+            for (uint8_t i = 0; i < AX25_HEADER_LEN; ++i)
+            {
+                Assert::AreEqual((uint8_t) 0, createFrameHeader(&CALLSIGN_SOURCE, buffer, i));
+            }
+        }
+
+        TEST_METHOD(Should_return_0_if_callsign_or_buffer_is_nullptr)
+        {
+            uint8_t buffer[AX25_HEADER_LEN];
+
+            Assert::AreEqual((uint8_t) 0, createFrameHeader(nullptr, buffer, AX25_HEADER_LEN));
+            Assert::AreEqual((uint8_t) 0, createFrameHeader(&CALLSIGN_SOURCE, nullptr, AX25_HEADER_LEN));
+        }
+    };
+}
@@ -0,0 +1,44 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_createMicEDestination)
+    {
+        void AssertAreEqual(const char* pExpectedDestination,
+                            uint8_t latDegrees, fixedPointW2F6_t latMinutes, HEMISPHERE latHemisphere,
+                            uint8_t lonDegrees, HEMISPHERE lonHemisphere)
+        {
+            const AngularCoordinate latitude = { true, latDegrees, latMinutes, latHemisphere };
+            const AngularCoordinate longitude = { true, lonDegrees, 0, lonHemisphere };
+            uint8_t destination[6];
+
+            createMicEDestination(&latitude, &longitude, destination);
+            Assert::AreEqual(0, memcmp(pExpectedDestination, destination, 6));
+        }
+
+        TEST_METHOD(Should_encode_latitude_digits_with_en_route_message_bits)
+        {
+            AssertAreEqual("SS2UVT", 33, 25640000, H_NORTH, 112, H_WEST);
+        }
+
+        TEST_METHOD(Should_encode_south_and_east_as_digits)
+        {
+            AssertAreEqual("SS2564", 33, 25640000, H_SOUTH, 50, H_EAST);
+        }
+
+        TEST_METHOD(Should_set_longitude_offset_below_10_and_from_100_degrees)
+        {
+            AssertAreEqual("QP1WR2", 10, 17224400, H_NORTH, 5, H_EAST);
+            AssertAreEqual("QP1W22", 10, 17224400, H_NORTH, 99, H_EAST);
+            AssertAreEqual("QP1WR2", 10, 17224400, H_NORTH, 100, H_EAST);
+        }
+
+        TEST_METHOD(Should_drop_thousandths_of_minutes)
+        {
+            AssertAreEqual("PP0P0Y", 0, 99999, H_NORTH, 10, H_WEST);
+            AssertAreEqual("UY5999", 59, 59999999, H_SOUTH, 10, H_EAST);
+        }
+    };
+}
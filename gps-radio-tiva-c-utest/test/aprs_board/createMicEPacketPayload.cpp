@@ -0,0 +1,127 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_createMicEPacketPayload)
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            gpsData.isValid = true;
+
+            gpsData.gpggaData.utcTime.isValid = true;
+            gpsData.gpggaData.utcTime.hours = 12;
+            gpsData.gpggaData.utcTime.minutes = 17;
+            gpsData.gpggaData.utcTime.seconds = 3344;
+
+            gpsData.gpggaData.latitude.isValid = true;
+            gpsData.gpggaData.latitude.hemisphere = H_NORTH;
+            gpsData.gpggaData.latitude.degrees = 10;
+            gpsData.gpggaData.latitude.minutes = 17224400;
+
+            gpsData.gpggaData.longitude.isValid = true;
+            gpsData.gpggaData.longitude.hemisphere = H_EAST;
+            gpsData.gpggaData.longitude.degrees = 173;
+            gpsData.gpggaData.longitude.minutes = 49246400;
+
+            gpsData.gpggaData.fixType = GPSFT_GPS;
+            gpsData.gpggaData.numberOfSattelitesInUse = 14;
+            gpsData.gpggaData.altitudeMslMeters = 1900;
+
+            gpsData.gpvtgData.speedKph = 130;
+            gpsData.gpvtgData.trueCourseDegrees = 180;
+
+            telemetry.cpuTemperature = 1700;
+            telemetry.voltage = 900;
+
+            gpsDataSource = GPS_ID_VENUS;
+
+            memset(buffer, 0, BUFFER_SIZE);
+            createFrameHeader(&CALLSIGN_SOURCE, header, AX25_HEADER_LEN);
+        }
+
+        void AssertAreEqual(const char* pExpectedBuffer, uint8_t expectedSize)
+        {
+            Assert::AreEqual(expectedSize, createMicEPacketPayload(gpsDataSource, &gpsData, &telemetry, 11, header, buffer, BUFFER_SIZE));
+            Assert::AreEqual(0, memcmp(pExpectedBuffer, buffer, expectedSize));
+        }
+
+        void AssertStartsWith(const char* pExpectedBuffer, uint8_t expectedSize)
+        {
+            Assert::AreEqual((uint8_t) (MIC_E_LEN + COMPRESSED_TELEMETRY_LEN), createMicEPacketPayload(gpsDataSource, &gpsData, &telemetry, 11, header, buffer, BUFFER_SIZE));
+            Assert::AreEqual(0, memcmp(pExpectedBuffer, buffer, expectedSize));
+        }
+
+        TEST_METHOD(Should_format_longitude_speed_course_symbol_altitude_and_telemetry)
+        {
+            const char expected[] = "`eM4\x1C" "b.>/\"5z}|!,!\"\"p!{!4|";
+            AssertAreEqual(expected, sizeof(expected) - 1);
+        }
+
+        TEST_METHOD(Should_put_latitude_into_destination_address)
+        {
+            const uint8_t expectedDestination[AX25_ADDRESS_LEN] = { 'Q' << 1, 'P' << 1, '1' << 1, 'W' << 1, 'R' << 1, '2' << 1, 0xE0 };
+            uint8_t expectedRest[AX25_HEADER_LEN - AX25_ADDRESS_LEN];
+            memcpy(expectedRest, &header[AX25_ADDRESS_LEN], sizeof(expectedRest));
+
+            Assert::AreNotEqual((uint8_t) 0, createMicEPacketPayload(gpsDataSource, &gpsData, &telemetry, 11, header, buffer, BUFFER_SIZE));
+            Assert::AreEqual(0, memcmp(expectedDestination, header, AX25_ADDRESS_LEN));
+            Assert::AreEqual(0, memcmp(expectedRest, &header[AX25_ADDRESS_LEN], sizeof(expectedRest)));
+        }
+
+        TEST_METHOD(Should_offset_longitude_degrees_and_minutes)
+        {
+            gpsData.gpggaData.longitude.minutes = 5000000;
+
+            gpsData.gpggaData.longitude.degrees = 5;
+            AssertStartsWith("`{]\x1C", 4);
+            gpsData.gpggaData.longitude.degrees = 50;
+            AssertStartsWith("`N]\x1C", 4);
+            gpsData.gpggaData.longitude.degrees = 105;
+            AssertStartsWith("`q]\x1C", 4);
+            gpsData.gpggaData.longitude.degrees = 179;
+            AssertStartsWith("`k]\x1C", 4);
+        }
+
+        TEST_METHOD(Should_split_speed_and_course)
+        {
+            gpsData.gpvtgData.speedKph = 2370;    // 128 knots
+            gpsData.gpvtgData.trueCourseDegrees = 3590;
+            AssertStartsWith("`eM4(oW", 7);
+        }
+
+        TEST_METHOD(Should_clamp_speed_above_799_knots)
+        {
+            gpsData.gpvtgData.speedKph = 20000;   // 1080 knots
+            gpsData.gpvtgData.trueCourseDegrees = 3590;
+            AssertStartsWith("`eM4kyW", 7);
+        }
+
+        TEST_METHOD(Should_fall_back_to_uncompressed_telemetry_without_position)
+        {
+            uint8_t expectedHeader[AX25_HEADER_LEN];
+            memcpy(expectedHeader, header, AX25_HEADER_LEN);
+            gpsData.gpggaData.longitude.isValid = false;
+
+            AssertAreEqual("T#011,001,170,090,000,000,00000000 a=00190", 42);
+            Assert::AreEqual(0, memcmp(expectedHeader, header, AX25_HEADER_LEN));
+        }
+
+        TEST_METHOD(Should_return_0_if_there_is_not_enough_space)
+        {
+            for (uint8_t i = 0; i < MIC_E_LEN + COMPRESSED_TELEMETRY_LEN; ++i)
+            {
+                Assert::AreEqual((uint8_t) 0, createMicEPacketPayload(gpsDataSource, &gpsData, &telemetry, 11, header, buffer, i));
+            }
+        }
+
+        static const uint8_t BUFFER_SIZE = 255;
+
+        GpsData gpsData;
+        Telemetry telemetry;
+        GpsDataSource gpsDataSource;
+        uint8_t header[AX25_HEADER_LEN];
+        uint8_t buffer[BUFFER_SIZE];
+    };
+}
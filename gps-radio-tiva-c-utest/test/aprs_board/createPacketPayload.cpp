@@ -244,6 +244,12 @@ namespace nmea_messages_test
             AssertAreEqual("@121733z1017.22N/17349.24E>018/013T#473,001,170,090,000,000,00000000 a=00190", 473);
         }
 
+        TEST_METHOD(Should_keep_three_least_significant_digits_for_message_idx)
+        {
+            AssertAreEqual("@121733z1017.22N/17349.24E>018/013T#000,001,170,090,000,000,00000000 a=00190", 1000);
+            AssertAreEqual("@121733z1017.22N/17349.24E>018/013T#535,001,170,090,000,000,00000000 a=00190", 65535);
+        }
+
         TEST_METHOD(Should_properly_add_leading_zeroes_for_gps_data_source)
         {
             gpsDataSource = GPS_ID_VENUS;
@@ -0,0 +1,57 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_ddsPulseWidth)
+    {
+        TEST_METHOD(Should_return_middle_pulse_width_at_zero_and_half_period)
+        {
+            Assert::AreEqual((uint32_t) DDS_AMPLITUDE_SHIFT, ddsPulseWidth(0x00000000));
+            Assert::AreEqual((uint32_t) DDS_AMPLITUDE_SHIFT, ddsPulseWidth(0x80000000));
+        }
+
+        TEST_METHOD(Should_return_max_pulse_width_at_quarter_period)
+        {
+            Assert::AreEqual((uint32_t) PWM_MAX_PULSE_WIDTH, ddsPulseWidth(0x40000000));
+        }
+
+        TEST_METHOD(Should_return_min_pulse_width_at_three_quarters_period)
+        {
+            Assert::AreEqual((uint32_t) PWM_MIN_PULSE_WIDTH, ddsPulseWidth(0xC0000000));
+        }
+
+        TEST_METHOD(Should_be_symmetric_around_half_period)
+        {
+            for (uint32_t phase = 0; phase < 0x80000000; phase += 0x00100000)
+            {
+                Assert::AreEqual(2 * DDS_AMPLITUDE_SHIFT - ddsPulseWidth(phase), ddsPulseWidth(phase + 0x80000000));
+            }
+        }
+
+        TEST_METHOD(Should_always_stay_within_pwm_pulse_width_limits)
+        {
+            for (uint32_t phase = 0; phase < 0xFFF00000; phase += 0x00100000)
+            {
+                const uint32_t pulseWidth = ddsPulseWidth(phase);
+                Assert::IsTrue(pulseWidth >= PWM_MIN_PULSE_WIDTH && pulseWidth <= PWM_MAX_PULSE_WIDTH);
+            }
+        }
+
+        TEST_METHOD(F1200_phase_increment_should_complete_one_period_per_symbol)
+        {
+            uint32_t phase = 0;
+            for (uint8_t i = 0; i < F1200_PWM_PULSES_COUNT_PER_SYMBOL; ++i)
+            {
+                phase += DDS_PHASE_INCREMENT_F1200;
+            }
+            Assert::AreEqual((uint32_t) 0, phase);
+        }
+
+        TEST_METHOD(F2200_phase_increment_should_be_proportional_to_F1200_phase_increment)
+        {
+            Assert::AreEqual((uint32_t) (DDS_PHASE_INCREMENT_F1200 * 11ULL / 6), DDS_PHASE_INCREMENT_F2200);
+        }
+    };
+}
@@ -21,7 +21,7 @@ namespace nmea_messages_test
             messageData[0] = 0b1111'0000;
             messageData[1] = 0b0101'0101;
             messageData[2] = 0b0000'0000;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 3, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 3, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
             Assert::AreEqual((uint16_t) 3, encodingData.bitstreamSize.bitstreamCharIdx);
             Assert::AreEqual((uint8_t) 0, encodingData.bitstreamSize.bitstreamCharBitIdx);
             Assert::AreEqual((uint8_t) 0b0000'0101, bitstreamBuffer[0]);
@@ -33,7 +33,7 @@ namespace nmea_messages_test
         {
             messageData[0] = 0b1111'1111;
             messageData[1] = 0b1111'1111;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_PERFORM_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_PERFORM_STUFFING, SHIFT_ONE_LEFT_NO));
             Assert::AreEqual((uint16_t) 2, encodingData.bitstreamSize.bitstreamCharIdx);
             Assert::AreEqual((uint8_t) 3, encodingData.bitstreamSize.bitstreamCharBitIdx);
             Assert::AreEqual((uint8_t) 0b1110'0000, bitstreamBuffer[0]);
@@ -45,7 +45,7 @@ namespace nmea_messages_test
         {
             messageData[0] = 0b1111'1111;
             messageData[1] = 0b1101'1110;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_PERFORM_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_PERFORM_STUFFING, SHIFT_ONE_LEFT_NO));
             Assert::AreEqual((uint16_t) 2, encodingData.bitstreamSize.bitstreamCharIdx);
             Assert::AreEqual((uint8_t) 1, encodingData.bitstreamSize.bitstreamCharBitIdx);
             Assert::AreEqual((uint8_t) 0b1110'0000, bitstreamBuffer[0]);
@@ -56,7 +56,7 @@ namespace nmea_messages_test
         {
             messageData[0] = 0b1111'1111;
             messageData[1] = 0b1111'1111;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
             Assert::AreEqual((uint16_t) 2, encodingData.bitstreamSize.bitstreamCharIdx);
             Assert::AreEqual((uint8_t) 0, encodingData.bitstreamSize.bitstreamCharBitIdx);
             Assert::AreEqual((uint8_t) 0b0000'0000, bitstreamBuffer[0]);
@@ -66,116 +66,144 @@ namespace nmea_messages_test
         TEST_METHOD(Should_remember_last_encoded_bit_if_its_zero)
         {
             messageData[0] = 0b1111'1111;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 1, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
             Assert::AreEqual((uint8_t) 0, encodingData.lastBit);
         }
 
         TEST_METHOD(Should_remember_last_encoded_bit_if_its_one)
         {
             messageData[0] = 0b0111'1111;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 1, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
             Assert::AreEqual((uint8_t) 1, encodingData.lastBit);
         }
 
-        TEST_METHOD(Should_update_fcs_if_requested_but_no_stuffing)
-        {
-            messageData[0] = 0b1111'1111;
-            messageData[1] = 0b1010'1010;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_NO_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT_NO));
-            Assert::AreEqual((uint16_t) 0xF590, encodingData.fcs);
-        }
-
-        TEST_METHOD(Should_update_fcs_if_requested_with_stuffing_but_stuffing_bits_should_not_affect_fcs)
-        {
-            messageData[0] = 0b1111'1111;
-            messageData[1] = 0b1010'1010;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_NO_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT_NO));
-
-            const uint16_t noStuffingFcs = encodingData.fcs;
-
-            memset(&encodingData, 0, sizeof(EncodingData));
-
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT_NO));
-            Assert::AreEqual(noStuffingFcs, encodingData.fcs);
-        }
-
-        TEST_METHOD(Should_not_update_fcs_if_not_requested)
-        {
-            messageData[0] = 0b1111'1111;
-            messageData[1] = 0b1010'1010;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
-            Assert::AreEqual((uint16_t) 0x0, encodingData.fcs);
-        }
-
-        TEST_METHOD(Should_shift_all_bytes_one_bit_to_the_left_if_requested_without_fcs_or_stuffing)
+        TEST_METHOD(Should_shift_all_bytes_one_bit_to_the_left_if_requested_without_stuffing)
         {
             messageData[0] = 0b0111'1111;
             messageData[1] = 0b0010'1010;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_NO_STUFFING, SHIFT_ONE_LEFT));
             Assert::AreEqual((uint16_t) 2, encodingData.bitstreamSize.bitstreamCharIdx);
             Assert::AreEqual((uint8_t) 0, encodingData.bitstreamSize.bitstreamCharBitIdx);
             Assert::AreEqual((uint8_t) 0b1111'1111, bitstreamBuffer[0]);
             Assert::AreEqual((uint8_t) 0b0110'0110, bitstreamBuffer[1]);
-            Assert::AreEqual((uint16_t) 0x0, encodingData.fcs);
         }
 
-        TEST_METHOD(Should_shift_all_bytes_one_bit_to_the_left_if_requested_should_affect_fcs_and_stuffing_if_they_were_requested)
+        TEST_METHOD(Should_shift_all_bytes_one_bit_to_the_left_if_requested_should_affect_stuffing_if_it_was_requested)
         {
             messageData[0] = 0b0111'1111;
             messageData[1] = 0b0010'1010;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_PERFORM_STUFFING, SHIFT_ONE_LEFT));
             Assert::AreEqual((uint16_t) 2, encodingData.bitstreamSize.bitstreamCharIdx);
             Assert::AreEqual((uint8_t) 1, encodingData.bitstreamSize.bitstreamCharBitIdx);
             Assert::AreEqual((uint8_t) 0b0011'1111, bitstreamBuffer[0]);
             Assert::AreEqual((uint8_t) 0b0011'0010, bitstreamBuffer[1]);
             Assert::AreEqual((uint8_t) 0b0000'0001, bitstreamBuffer[2]);
-            Assert::AreEqual((uint16_t) 0xF2B9, encodingData.fcs);
         }
 
         TEST_METHOD(Should_not_shift_all_bytes_one_bit_to_the_left_if_not_requested)
         {
             messageData[0] = 0b0111'1111;
             messageData[1] = 0b0010'1010;
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
             Assert::AreEqual((uint16_t)2, encodingData.bitstreamSize.bitstreamCharIdx);
             Assert::AreEqual((uint8_t)0, encodingData.bitstreamSize.bitstreamCharBitIdx);
             Assert::AreEqual((uint8_t)0b1000'0000, bitstreamBuffer[0]);
             Assert::AreEqual((uint8_t)0b0100'1100, bitstreamBuffer[1]);
         }
 
+        TEST_METHOD(Should_keep_bits_already_encoded_into_current_byte)
+        {
+            bitstreamBuffer[0] = 0b0000'0101;
+            encodingData.bitstreamSize.bitstreamCharBitIdx = 3;
+            encodingData.lastBit = 1;
+            messageData[0] = 0b1111'1111;
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
+            Assert::AreEqual((uint16_t) 1, encodingData.bitstreamSize.bitstreamCharIdx);
+            Assert::AreEqual((uint8_t) 3, encodingData.bitstreamSize.bitstreamCharBitIdx);
+            Assert::AreEqual((uint8_t) 0b1111'1101, bitstreamBuffer[0]);
+            Assert::AreEqual((uint8_t) 0b0000'0111, bitstreamBuffer[1]);
+        }
+
+        TEST_METHOD(Should_match_bit_by_bit_encoding_for_all_byte_pairs_and_number_of_leading_ones)
+        {
+            for (uint8_t numberOfOnes = 0; numberOfOnes < 5; ++numberOfOnes)
+            {
+                for (uint32_t value = 0; value <= 0xFFFF; value += 7)
+                {
+                    messageData[0] = (uint8_t) (value & 0xFF);
+                    messageData[1] = (uint8_t) (value >> 8);
+
+                    memset(bitstreamBuffer, 0, 4);
+                    memset(&encodingData, 0, sizeof(EncodingData));
+                    encodingData.lastBit = (uint8_t) (value & 1);
+                    encodingData.numberOfOnes = numberOfOnes;
+
+                    uint8_t expectedBuffer[4] = { 0 };
+                    uint8_t expectedBitsCount = 0;
+                    uint8_t expectedLastBit = (uint8_t) (value & 1);
+                    uint8_t expectedNumberOfOnes = numberOfOnes;
+
+                    for (uint8_t iBit = 0; iBit < 16; ++iBit)
+                    {
+                        if (!(value & (1 << iBit)))
+                        {
+                            expectedLastBit ^= 1;
+                            expectedNumberOfOnes = 0;
+                        }
+                        expectedBuffer[expectedBitsCount / 8] |= (uint8_t) (expectedLastBit << (expectedBitsCount % 8));
+                        ++expectedBitsCount;
+                        if ((value & (1 << iBit)) && ++expectedNumberOfOnes == 5)
+                        {
+                            expectedLastBit ^= 1;
+                            expectedNumberOfOnes = 0;
+                            expectedBuffer[expectedBitsCount / 8] |= (uint8_t) (expectedLastBit << (expectedBitsCount % 8));
+                            ++expectedBitsCount;
+                        }
+                    }
+
+                    Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 2, ST_PERFORM_STUFFING, SHIFT_ONE_LEFT_NO));
+                    Assert::AreEqual((uint16_t) (expectedBitsCount / 8), encodingData.bitstreamSize.bitstreamCharIdx);
+                    Assert::AreEqual((uint8_t) (expectedBitsCount % 8), encodingData.bitstreamSize.bitstreamCharBitIdx);
+                    Assert::AreEqual(expectedLastBit, encodingData.lastBit);
+                    Assert::AreEqual(expectedNumberOfOnes, encodingData.numberOfOnes);
+                    Assert::AreEqual(0, memcmp(expectedBuffer, bitstreamBuffer, 4));
+                }
+            }
+        }
+
         TEST_METHOD(Should_return_false_in_case_of_buffer_overflow)
         {
             encodingData.bitstreamSize.bitstreamCharBitIdx = 7;
-            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 10, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 10, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
             encodingData.bitstreamSize.bitstreamCharIdx = 1;
             encodingData.bitstreamSize.bitstreamCharBitIdx = 0;
-            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 10, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, 10, &encodingData, messageData, 10, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
         }
 
         TEST_METHOD(Should_ignore_empty_message)
         {
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, BUFFER_DATA_SIZE, &encodingData, messageData, 0, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
-            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 0, &encodingData, messageData, 0, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, BUFFER_DATA_SIZE, &encodingData, messageData, 0, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
+            Assert::IsTrue(encodeAndAppendBits(bitstreamBuffer, 0, &encodingData, messageData, 0, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
         }
 
         TEST_METHOD(Should_return_false_if_message_is_not_empty_but_data_is_nullptr)
         {
-            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, BUFFER_DATA_SIZE, &encodingData, nullptr, MESSAGE_DATA_SIZE, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, BUFFER_DATA_SIZE, &encodingData, nullptr, MESSAGE_DATA_SIZE, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
         }
 
         TEST_METHOD(Should_return_false_if_encoding_data_is_nullptr)
         {
-            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, BUFFER_DATA_SIZE, nullptr, messageData, MESSAGE_DATA_SIZE, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, BUFFER_DATA_SIZE, nullptr, messageData, MESSAGE_DATA_SIZE, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
         }
 
         TEST_METHOD(Should_return_false_if_buffer_size_is_0)
         {
-            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, 0, &encodingData, messageData, MESSAGE_DATA_SIZE, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsFalse(encodeAndAppendBits(bitstreamBuffer, 0, &encodingData, messageData, MESSAGE_DATA_SIZE, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
         }
 
         TEST_METHOD(Should_return_false_if_buffer_is_nullptr)
         {
-            Assert::IsFalse(encodeAndAppendBits(nullptr, 10, &encodingData, messageData, MESSAGE_DATA_SIZE, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO));
+            Assert::IsFalse(encodeAndAppendBits(nullptr, 10, &encodingData, messageData, MESSAGE_DATA_SIZE, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
         }
 
         static const uint16_t MESSAGE_DATA_SIZE = 65535 / 2;
@@ -0,0 +1,38 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_encodeBase91)
+    {
+        TEST_METHOD(Should_encode_most_significant_digit_first)
+        {
+            uint8_t buffer[4] = { 0 };
+
+            encodeBase91(0, buffer, 2);
+            Assert::AreEqual(0, memcmp("!!", buffer, 2));
+
+            encodeBase91(90, buffer, 2);
+            Assert::AreEqual(0, memcmp("!{", buffer, 2));
+
+            encodeBase91(91, buffer, 2);
+            Assert::AreEqual(0, memcmp("\"!", buffer, 2));
+
+            encodeBase91(91 * 91 - 1, buffer, 2);
+            Assert::AreEqual(0, memcmp("{{", buffer, 2));
+
+            encodeBase91(91 * 91 * 91 * 91 - 1, buffer, 4);
+            Assert::AreEqual(0, memcmp("{{{{", buffer, 4));
+        }
+
+        TEST_METHOD(Should_not_touch_buffer_past_requested_digits)
+        {
+            uint8_t buffer[4] = { 0, 0, 0xAA, 0xAA };
+
+            encodeBase91(12345, buffer, 2);
+            Assert::AreEqual((uint8_t) 0xAA, buffer[2]);
+            Assert::AreEqual((uint8_t) 0xAA, buffer[3]);
+        }
+    };
+}
@@ -0,0 +1,32 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_formatAngularCoordinate)
+    {
+        void AssertAreEqual(const char* pExpectedBuffer, uint8_t degrees, fixedPointW2F6_t minutes, HEMISPHERE hemisphere, uint8_t degreesWidth)
+        {
+            const AngularCoordinate coordinate = { true, degrees, minutes, hemisphere };
+            const uint8_t expectedSize = (uint8_t) strlen(pExpectedBuffer);
+            uint8_t buffer[16];
+
+            Assert::AreEqual(expectedSize, formatAngularCoordinate(&coordinate, degreesWidth, buffer));
+            Assert::AreEqual(0, memcmp(pExpectedBuffer, buffer, expectedSize));
+        }
+
+        TEST_METHOD(Should_format_latitude)
+        {
+            AssertAreEqual("1017.22N", 10, 17224400, H_NORTH, 2);
+            AssertAreEqual("0000.00S", 0, 0, H_SOUTH, 2);
+            AssertAreEqual("8959.99N", 89, 59999999, H_NORTH, 2);
+        }
+
+        TEST_METHOD(Should_format_longitude)
+        {
+            AssertAreEqual("17349.24E", 173, 49246400, H_EAST, 3);
+            AssertAreEqual("00501.05W", 5, 1050000, H_WEST, 3);
+        }
+    };
+}
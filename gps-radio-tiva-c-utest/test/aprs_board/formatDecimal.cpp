@@ -0,0 +1,41 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_formatDecimal)
+    {
+        void AssertAreEqual(const char* pExpectedBuffer, uint32_t value, uint8_t width)
+        {
+            uint8_t buffer[16];
+            memset(buffer, 0xAA, sizeof(buffer));
+
+            Assert::AreEqual(width, formatDecimal(value, width, buffer));
+            Assert::AreEqual(0, memcmp(pExpectedBuffer, buffer, width));
+            Assert::AreEqual((uint8_t) 0xAA, buffer[width]);
+        }
+
+        TEST_METHOD(Should_add_leading_zeroes)
+        {
+            AssertAreEqual("00", 0, 2);
+            AssertAreEqual("07", 7, 2);
+            AssertAreEqual("007", 7, 3);
+            AssertAreEqual("00190", 190, 5);
+        }
+
+        TEST_METHOD(Should_format_values_taking_whole_width)
+        {
+            AssertAreEqual("59", 59, 2);
+            AssertAreEqual("999", 999, 3);
+            AssertAreEqual("4294967295", 4294967295u, 10);
+        }
+
+        TEST_METHOD(Should_drop_digits_which_do_not_fit)
+        {
+            AssertAreEqual("000", 1000, 3);
+            AssertAreEqual("473", 65473, 3);
+            AssertAreEqual("5", 12345, 1);
+        }
+    };
+}
@@ -0,0 +1,86 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+extern "C"
+{
+    extern uint16_t g_aprsMessageId;
+}
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_generateMessage)
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            initializeFrameHeaderCache(&CALLSIGN_SOURCE, &headerCache);
+
+            memset(&gpsData, 0, sizeof(gpsData));
+            gpsData.isValid = true;
+            telemetry.cpuTemperature = 1700;
+            telemetry.voltage = 900;
+
+            messages[0].gpsDataSource = GPS_ID_VENUS;
+            messages[0].pGpsData = &gpsData;
+            messages[1].gpsDataSource = GPS_ID_COPERNICUS;
+            messages[1].pGpsData = &gpsData;
+        }
+
+        TEST_METHOD(Should_start_burst_with_same_bitstream_as_first_message_without_suffix_flags)
+        {
+            static uint8_t singleBitstream[APRS_BITSTREAM_MAX_LEN];
+            static uint8_t burstBitstream[APRS_BITSTREAM_MAX_LEN];
+            BitstreamPos singleSize;
+            BitstreamPos burstSize;
+            uint8_t singleLastBit;
+            uint8_t burstLastBit;
+
+            // message id is part of payload
+            g_aprsMessageId = 0;
+            Assert::IsTrue(generateMessage(&headerCache, messages, 1, &telemetry, singleBitstream, APRS_BITSTREAM_MAX_LEN, &singleSize, &singleLastBit));
+            g_aprsMessageId = 0;
+            Assert::IsTrue(generateMessage(&headerCache, messages, 2, &telemetry, burstBitstream, APRS_BITSTREAM_MAX_LEN, &burstSize, &burstLastBit));
+
+            const uint32_t singleBits = singleSize.bitstreamCharIdx * 8 + singleSize.bitstreamCharBitIdx;
+            const uint32_t burstBits = burstSize.bitstreamCharIdx * 8 + burstSize.bitstreamCharBitIdx;
+            Assert::IsTrue(burstBits > singleBits);
+
+            const uint32_t firstFrameBits = singleBits - SUFFIX_FLAGS_COUNT * 8;
+            for (uint32_t i = 0; i < firstFrameBits; ++i)
+            {
+                Assert::AreEqual(singleBitstream[i / 8] & (1 << (i % 8)), burstBitstream[i / 8] & (1 << (i % 8)));
+            }
+        }
+
+        TEST_METHOD(Should_return_false_if_there_are_no_messages_or_too_many_of_them)
+        {
+            static uint8_t bitstream[APRS_BITSTREAM_MAX_LEN];
+            BitstreamPos size;
+            uint8_t lastBit;
+
+            Assert::IsFalse(generateMessage(&headerCache, messages, 0, &telemetry, bitstream, APRS_BITSTREAM_MAX_LEN, &size, &lastBit));
+            Assert::IsFalse(generateMessage(&headerCache, messages, APRS_BURST_MAX_MESSAGES + 1, &telemetry, bitstream, APRS_BITSTREAM_MAX_LEN, &size, &lastBit));
+            Assert::IsFalse(generateMessage(&headerCache, nullptr, 1, &telemetry, bitstream, APRS_BITSTREAM_MAX_LEN, &size, &lastBit));
+        }
+
+        TEST_METHOD(Should_return_level_bitstream_ends_at)
+        {
+            static uint8_t bitstream[APRS_BITSTREAM_MAX_LEN];
+            BitstreamPos size;
+            uint8_t lastBit;
+
+            for (uint8_t messagesCount = 1; messagesCount <= 2; ++messagesCount)
+            {
+                Assert::IsTrue(generateMessage(&headerCache, messages, messagesCount, &telemetry, bitstream, APRS_BITSTREAM_MAX_LEN, &size, &lastBit));
+
+                const uint32_t lastBitIdx = size.bitstreamCharIdx * 8 + size.bitstreamCharBitIdx - 1;
+                Assert::AreEqual((uint8_t) ((bitstream[lastBitIdx / 8] >> (lastBitIdx % 8)) & 1), lastBit);
+            }
+        }
+
+        FrameHeaderCache headerCache;
+        GpsData gpsData;
+        Telemetry telemetry;
+        AprsMessage messages[APRS_BURST_MAX_MESSAGES + 1];
+    };
+}
@@ -0,0 +1,53 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_initializeFrameHeaderCache)
+    {
+        TEST_METHOD(Should_cache_header_and_its_not_post_processed_fcs)
+        {
+            uint8_t expectedHeader[AX25_HEADER_LEN];
+            FrameHeaderCache cache;
+
+            Assert::IsTrue(initializeFrameHeaderCache(&CALLSIGN_SOURCE, &cache));
+
+            Assert::AreEqual((uint8_t) AX25_HEADER_LEN, createFrameHeader(&CALLSIGN_SOURCE, expectedHeader, AX25_HEADER_LEN));
+            Assert::AreEqual(0, memcmp(expectedHeader, cache.header, AX25_HEADER_LEN));
+            Assert::AreEqual(ax25FcsUpdate(FCS_INITIAL_VALUE, expectedHeader, AX25_HEADER_LEN), cache.fcs);
+        }
+
+        TEST_METHOD(Should_cache_same_bitstream_and_encoding_state_as_encoding_flags_and_header)
+        {
+            uint8_t header[AX25_HEADER_LEN];
+            uint8_t expectedBitstream[APRS_HEADER_BITSTREAM_MAX_LEN] = { 0 };
+            EncodingData expectedEncodingData = { 0 };
+            expectedEncodingData.lastBit = 1;
+            FrameHeaderCache cache;
+
+            createFrameHeader(&CALLSIGN_SOURCE, header, AX25_HEADER_LEN);
+            for (uint8_t i = 0; i < PREFIX_FLAGS_COUNT; ++i)
+            {
+                Assert::IsTrue(encodeAndAppendBits(expectedBitstream, APRS_HEADER_BITSTREAM_MAX_LEN, &expectedEncodingData, (const uint8_t*) "\x7E", 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO));
+            }
+            Assert::IsTrue(encodeAndAppendBits(expectedBitstream, APRS_HEADER_BITSTREAM_MAX_LEN, &expectedEncodingData, header, AX25_HEADER_LEN, ST_PERFORM_STUFFING, SHIFT_ONE_LEFT_NO));
+
+            Assert::IsTrue(initializeFrameHeaderCache(&CALLSIGN_SOURCE, &cache));
+
+            Assert::AreEqual(expectedEncodingData.lastBit, cache.encodingData.lastBit);
+            Assert::AreEqual(expectedEncodingData.numberOfOnes, cache.encodingData.numberOfOnes);
+            Assert::AreEqual(expectedEncodingData.bitstreamSize.bitstreamCharIdx, cache.encodingData.bitstreamSize.bitstreamCharIdx);
+            Assert::AreEqual(expectedEncodingData.bitstreamSize.bitstreamCharBitIdx, cache.encodingData.bitstreamSize.bitstreamCharBitIdx);
+            Assert::AreEqual(0, memcmp(expectedBitstream, cache.bitstream, APRS_HEADER_BITSTREAM_MAX_LEN));
+        }
+
+        TEST_METHOD(Should_return_false_if_callsign_or_cache_is_nullptr)
+        {
+            FrameHeaderCache cache;
+
+            Assert::IsFalse(initializeFrameHeaderCache(nullptr, &cache));
+            Assert::IsFalse(initializeFrameHeaderCache(&CALLSIGN_SOURCE, nullptr));
+        }
+    };
+}
@@ -0,0 +1,138 @@
+#include "..\..\stdafx.h"
+
+#include "aprs_board_test.h"
+
+extern "C"
+{
+    extern volatile bool g_sendingMessage;
+    extern bool g_invertBitstream;
+    extern BitstreamBuffer g_bitstreamBuffers[APRS_BITSTREAM_BUFFERS_COUNT];
+    extern uint8_t g_nextBitstreamBufferIdx;
+    extern uint8_t g_onAirBitstreamBufferIdx;
+    extern FrameHeaderCache g_frameHeaderCache;
+}
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(aprs_board_test_transmitAprsMessage)
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            g_sendingMessage = false;
+            memset(g_bitstreamBuffers, 0, sizeof(g_bitstreamBuffers));
+            g_nextBitstreamBufferIdx = 0;
+            g_onAirBitstreamBufferIdx = 0;
+            initializeFrameHeaderCache(&CALLSIGN_SOURCE, &g_frameHeaderCache);
+
+            memset(&gpsData, 0, sizeof(gpsData));
+            gpsData.isValid = true;
+            telemetry.cpuTemperature = 1700;
+            telemetry.voltage = 900;
+
+            venusMessage.gpsDataSource = GPS_ID_VENUS;
+            venusMessage.pGpsData = &gpsData;
+            copernicusMessage.gpsDataSource = GPS_ID_COPERNICUS;
+            copernicusMessage.pGpsData = &gpsData;
+        }
+
+        TEST_METHOD(Should_not_transmit_if_message_was_not_prepared)
+        {
+            Assert::IsFalse(transmitAprsMessage());
+            Assert::IsFalse(g_sendingMessage);
+        }
+
+        TEST_METHOD(Should_key_up_and_put_buffer_on_air_if_transmitter_is_idle)
+        {
+            Assert::IsTrue(prepareAprsMessage(&venusMessage, 1, &telemetry));
+            Assert::AreEqual((int) BBS_PREPARED, (int) g_bitstreamBuffers[0].state);
+            Assert::IsFalse(g_sendingMessage);
+
+            Assert::IsTrue(transmitAprsMessage());
+            Assert::IsTrue(g_sendingMessage);
+            Assert::AreEqual((int) BBS_ON_AIR, (int) g_bitstreamBuffers[0].state);
+            Assert::AreEqual((uint8_t) 0, g_onAirBitstreamBufferIdx);
+            Assert::AreEqual((uint8_t) 1, g_nextBitstreamBufferIdx);
+        }
+
+        TEST_METHOD(Should_queue_next_buffer_while_current_one_is_on_air)
+        {
+            Assert::IsTrue(sendAprsMessage(&venusMessage, 1, &telemetry));
+            Assert::IsTrue(sendAprsMessage(&copernicusMessage, 1, &telemetry));
+
+            Assert::AreEqual((int) BBS_ON_AIR, (int) g_bitstreamBuffers[0].state);
+            Assert::AreEqual((int) BBS_QUEUED, (int) g_bitstreamBuffers[1].state);
+
+            // both buffers are owned by Pwm10Handler
+            Assert::IsFalse(prepareAprsMessage(&venusMessage, 1, &telemetry));
+        }
+
+        TEST_METHOD(Should_switch_to_queued_buffer_and_free_sent_one)
+        {
+            Assert::IsTrue(sendAprsMessage(&venusMessage, 1, &telemetry));
+            Assert::IsTrue(sendAprsMessage(&copernicusMessage, 1, &telemetry));
+
+            Assert::IsTrue(switchToNextBitstreamBuffer());
+            Assert::AreEqual((int) BBS_FREE, (int) g_bitstreamBuffers[0].state);
+            Assert::AreEqual((int) BBS_ON_AIR, (int) g_bitstreamBuffers[1].state);
+            Assert::AreEqual((uint8_t) 1, g_onAirBitstreamBufferIdx);
+
+            Assert::IsTrue(prepareAprsMessage(&venusMessage, 1, &telemetry));
+            Assert::AreEqual((int) BBS_PREPARED, (int) g_bitstreamBuffers[0].state);
+        }
+
+        TEST_METHOD(Should_not_switch_to_buffer_which_is_only_prepared)
+        {
+            Assert::IsTrue(sendAprsMessage(&venusMessage, 1, &telemetry));
+            Assert::IsTrue(prepareAprsMessage(&copernicusMessage, 1, &telemetry));
+
+            Assert::IsFalse(switchToNextBitstreamBuffer());
+            Assert::AreEqual((int) BBS_FREE, (int) g_bitstreamBuffers[0].state);
+            Assert::AreEqual((int) BBS_PREPARED, (int) g_bitstreamBuffers[1].state);
+        }
+
+        TEST_METHOD(Should_invert_queued_buffer_if_sent_one_ends_at_level_zero)
+        {
+            // telemetry is part of payload, look for one which makes bitstream end at level zero
+            bool isLevelZeroFound = false;
+            for (telemetry.voltage = 900; telemetry.voltage < 1000 && !isLevelZeroFound; ++telemetry.voltage)
+            {
+                Assert::IsTrue(prepareAprsMessage(&venusMessage, 1, &telemetry));
+                isLevelZeroFound = g_bitstreamBuffers[0].lastBit == 0;
+            }
+            Assert::IsTrue(isLevelZeroFound);
+
+            Assert::IsTrue(transmitAprsMessage());
+            Assert::IsFalse(g_invertBitstream);
+            Assert::IsTrue(sendAprsMessage(&copernicusMessage, 1, &telemetry));
+
+            Assert::IsTrue(switchToNextBitstreamBuffer());
+            Assert::IsTrue(g_invertBitstream);
+
+            // opening flag starts with zero so its first bit on air has to change level
+            Assert::AreEqual((uint8_t) 1, (uint8_t) ((g_bitstreamBuffers[1].bitstream[0] & 1) ^ (g_invertBitstream ? 1 : 0)));
+        }
+
+        TEST_METHOD(Should_not_invert_queued_buffer_if_sent_one_ends_at_level_one)
+        {
+            bool isLevelOneFound = false;
+            for (telemetry.voltage = 900; telemetry.voltage < 1000 && !isLevelOneFound; ++telemetry.voltage)
+            {
+                Assert::IsTrue(prepareAprsMessage(&venusMessage, 1, &telemetry));
+                isLevelOneFound = g_bitstreamBuffers[0].lastBit == 1;
+            }
+            Assert::IsTrue(isLevelOneFound);
+
+            Assert::IsTrue(transmitAprsMessage());
+            Assert::IsTrue(sendAprsMessage(&copernicusMessage, 1, &telemetry));
+
+            Assert::IsTrue(switchToNextBitstreamBuffer());
+            Assert::IsFalse(g_invertBitstream);
+            Assert::AreEqual((uint8_t) 0, (uint8_t) (g_bitstreamBuffers[1].bitstream[0] & 1));
+        }
+
+        GpsData gpsData;
+        Telemetry telemetry;
+        AprsMessage venusMessage;
+        AprsMessage copernicusMessage;
+    };
+}
@@ -0,0 +1,31 @@
+#include "..\..\stdafx.h"
+
+#include "ax25_fcs_test.h"
+
+namespace ax25_fcs_test
+{
+    TEST_CLASS(ax25_fcs_test_ax25Fcs)
+    {
+        TEST_METHOD(Should_calculate_crc_16_x25_check_value)
+        {
+            const uint8_t data[] = "123456789";
+            Assert::AreEqual((uint16_t) 0x906E, ax25Fcs(data, 9));
+        }
+
+        TEST_METHOD(Should_return_post_processed_initial_value_for_empty_data)
+        {
+            Assert::AreEqual((uint16_t) (FCS_INITIAL_VALUE ^ FCS_POST_PROCESSING_XOR_VALUE), ax25Fcs(nullptr, 0));
+        }
+
+        TEST_METHOD(Should_produce_good_residue_when_fcs_is_appended_low_byte_first)
+        {
+            uint8_t data[] = { 'H' << 1, 'A' << 1, 'B' << 1, 0x03, 0xF0, '!', 0, 0 };
+
+            const uint16_t fcs = ax25Fcs(data, 6);
+            data[6] = fcs & 0x00FF;
+            data[7] = (fcs >> 8) & 0x00FF;
+
+            Assert::AreEqual((uint16_t) 0xF0B8, ax25FcsUpdate(FCS_INITIAL_VALUE, data, 8));
+        }
+    };
+}
@@ -0,0 +1,40 @@
+#include "..\..\stdafx.h"
+
+#include "ax25_fcs_test.h"
+
+namespace ax25_fcs_test
+{
+    TEST_CLASS(ax25_fcs_test_ax25FcsUpdate)
+    {
+        TEST_METHOD(Should_update_fcs_starting_from_given_value)
+        {
+            const uint8_t data[] = { 0b1111'1111, 0b1010'1010 };
+            Assert::AreEqual((uint16_t) 0xF590, ax25FcsUpdate(0x0000, data, 2));
+        }
+
+        TEST_METHOD(Should_update_fcs_of_callsign_characters_shifted_one_bit_to_the_left)
+        {
+            const uint8_t data[] = { 0b0111'1111 << 1, 0b0010'1010 << 1 };
+            Assert::AreEqual((uint16_t) 0xF2B9, ax25FcsUpdate(0x0000, data, 2));
+        }
+
+        TEST_METHOD(Should_give_same_result_when_data_is_split_into_several_parts)
+        {
+            const uint8_t data[] = "HABHAB WIDE1 WIDE2 !1017.22N/17349.24E>018/013";
+            const uint16_t size = (uint16_t) (sizeof(data) - 1);
+
+            const uint16_t expectedFcs = ax25FcsUpdate(FCS_INITIAL_VALUE, data, size);
+
+            for (uint16_t split = 0; split <= size; ++split)
+            {
+                const uint16_t fcs = ax25FcsUpdate(FCS_INITIAL_VALUE, data, split);
+                Assert::AreEqual(expectedFcs, ax25FcsUpdate(fcs, &data[split], size - split));
+            }
+        }
+
+        TEST_METHOD(Should_not_change_fcs_for_empty_data)
+        {
+            Assert::AreEqual((uint16_t) 0x1234, ax25FcsUpdate(0x1234, nullptr, 0));
+        }
+    };
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+extern "C"
+{
+    #include <ax25_fcs.h>
+}
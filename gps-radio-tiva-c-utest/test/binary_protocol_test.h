@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string.h>
+
+// binary GPS protocols are parsed byte by byte and their fields are big endian
+template <typename Parser, bool (*parseByte)(Parser*, uint8_t)>
+class BinaryProtocolTest
+{
+    protected:
+        bool FEED(Parser* pParser, const uint8_t* pData, size_t dataLen)
+        {
+            bool result = false;
+
+            for (size_t i = 0; i < dataLen; ++i)
+            {
+                result = parseByte(pParser, pData[i]);
+            }
+
+            return result;
+        }
+
+        void WRITE_BIG_ENDIAN(uint8_t* pData, uint32_t value, uint8_t size)
+        {
+            for (uint8_t i = size; i > 0; --i)
+            {
+                pData[i - 1] = (uint8_t) value;
+                value >>= 8;
+            }
+        }
+
+        void WRITE_FLOAT(uint8_t* pData, float value)
+        {
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            WRITE_BIG_ENDIAN(pData, bits, 4);
+        }
+
+        void WRITE_DOUBLE(uint8_t* pData, double value)
+        {
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            WRITE_BIG_ENDIAN(pData, (uint32_t) (bits >> 32), 4);
+            WRITE_BIG_ENDIAN(pData + 4, (uint32_t) bits, 4);
+        }
+};
@@ -0,0 +1,30 @@
+#include "..\..\stdafx.h"
+
+#include "fx25_test.h"
+
+namespace fx25_test
+{
+    TEST_CLASS(fx25_test_fx25ModeForDataLen)
+    {
+        TEST_METHOD(Should_pick_the_shortest_code_which_fits_data)
+        {
+            Assert::AreEqual((uint8_t) 32, fx25ModeForDataLen(1)->dataLen);
+            Assert::AreEqual((uint8_t) 32, fx25ModeForDataLen(32)->dataLen);
+            Assert::AreEqual((uint8_t) 64, fx25ModeForDataLen(33)->dataLen);
+            Assert::AreEqual((uint8_t) 128, fx25ModeForDataLen(100)->dataLen);
+            Assert::AreEqual((uint8_t) 239, fx25ModeForDataLen(129)->dataLen);
+            Assert::AreEqual((uint8_t) 239, fx25ModeForDataLen(239)->dataLen);
+        }
+
+        TEST_METHOD(Should_return_correlation_tag_of_the_code)
+        {
+            Assert::IsTrue(0xB74DB7DF8A532F3EULL == fx25ModeForDataLen(239)->correlationTag);
+            Assert::IsTrue(0x8F056EB4369660EEULL == fx25ModeForDataLen(32)->correlationTag);
+        }
+
+        TEST_METHOD(Should_return_nullptr_if_data_is_too_long)
+        {
+            Assert::IsNull(fx25ModeForDataLen(240));
+        }
+    };
+}
@@ -0,0 +1,96 @@
+#include "..\..\stdafx.h"
+
+#include "fx25_test.h"
+
+namespace fx25_test
+{
+    TEST_CLASS(fx25_test_fx25ReedSolomonEncode)
+    {
+        TEST_METHOD(Should_produce_codeword_with_zero_syndromes)
+        {
+            uint8_t codeword[FX25_MAX_CODEBLOCK_LEN];
+            for (uint16_t i = 0; i < FX25_MAX_DATA_LEN; ++i)
+            {
+                codeword[i] = (uint8_t) (i * 7 + 3);
+            }
+
+            Assert::IsTrue(fx25ReedSolomonEncode(codeword, FX25_MAX_DATA_LEN, &codeword[FX25_MAX_DATA_LEN]));
+
+            for (uint8_t i = 0; i < FX25_CHECK_BYTES_COUNT; ++i)
+            {
+                Assert::AreEqual((uint8_t) 0, syndrome(codeword, FX25_MAX_CODEBLOCK_LEN, FX25_FIRST_CONSECUTIVE_ROOT + i));
+            }
+        }
+
+        TEST_METHOD(Should_produce_codeword_with_zero_syndromes_for_shortened_code)
+        {
+            uint8_t codeword[32 + FX25_CHECK_BYTES_COUNT];
+            memcpy(codeword, "\x7E\x96\x70\x9A\x9A\x9E\x40\xE0WIDE2-1 shortened codeblock..", 32);
+
+            Assert::IsTrue(fx25ReedSolomonEncode(codeword, 32, &codeword[32]));
+
+            for (uint8_t i = 0; i < FX25_CHECK_BYTES_COUNT; ++i)
+            {
+                Assert::AreEqual((uint8_t) 0, syndrome(codeword, sizeof(codeword), FX25_FIRST_CONSECUTIVE_ROOT + i));
+            }
+        }
+
+        TEST_METHOD(Should_produce_zero_check_bytes_for_zero_data)
+        {
+            const uint8_t data[64] = { 0 };
+            uint8_t checkBytes[FX25_CHECK_BYTES_COUNT];
+            memset(checkBytes, 0xFF, sizeof(checkBytes));
+
+            Assert::IsTrue(fx25ReedSolomonEncode(data, sizeof(data), checkBytes));
+
+            for (uint8_t i = 0; i < FX25_CHECK_BYTES_COUNT; ++i)
+            {
+                Assert::AreEqual((uint8_t) 0, checkBytes[i]);
+            }
+        }
+
+        TEST_METHOD(Should_return_false_if_data_is_too_long_or_nullptr)
+        {
+            uint8_t data[FX25_MAX_DATA_LEN + 1] = { 0 };
+            uint8_t checkBytes[FX25_CHECK_BYTES_COUNT];
+
+            Assert::IsFalse(fx25ReedSolomonEncode(data, FX25_MAX_DATA_LEN + 1, checkBytes));
+            Assert::IsFalse(fx25ReedSolomonEncode(nullptr, 1, checkBytes));
+            Assert::IsFalse(fx25ReedSolomonEncode(data, 1, nullptr));
+        }
+
+        static uint8_t multiply(uint8_t a, uint8_t b)
+        {
+            uint16_t product = 0;
+            for (uint16_t value = a; b; b >>= 1, value <<= 1)
+            {
+                if (value & 0x100)
+                {
+                    value ^= FX25_GF_POLYNOMIAL;
+                }
+                if (b & 1)
+                {
+                    product ^= value;
+                }
+            }
+            return (uint8_t) product;
+        }
+
+        // codeword evaluated at a^power, first byte is the highest coefficient
+        static uint8_t syndrome(const uint8_t* pCodeword, uint16_t len, uint8_t power)
+        {
+            uint8_t root = 1;
+            for (uint8_t i = 0; i < power; ++i)
+            {
+                root = multiply(root, 2);
+            }
+
+            uint8_t value = 0;
+            for (uint16_t i = 0; i < len; ++i)
+            {
+                value = multiply(value, root) ^ pCodeword[i];
+            }
+            return value;
+        }
+    };
+}
@@ -0,0 +1,59 @@
+#include "..\..\stdafx.h"
+
+#include "gps_conversions_test.h"
+
+namespace gps_conversions_test
+{
+    TEST_CLASS(gps_conversions_test_degreesE7ToAngularCoordinate)
+    {
+        TEST_METHOD(Valid_latitude_minutes_are_exact)
+        {
+            AngularCoordinate result;
+            degreesE7ToAngularCoordinate(481173000, true, &result);
+
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 48, result.degrees);
+            Assert::AreEqual((fixedPointW2F6_t) 7038000, result.minutes);
+            Assert::AreEqual(H_NORTH, result.hemisphere);
+        }
+
+        TEST_METHOD(Valid_negative_is_southern_and_western)
+        {
+            AngularCoordinate result;
+
+            degreesE7ToAngularCoordinate(-1151833333, false, &result);
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 115, result.degrees);
+            Assert::AreEqual((fixedPointW2F6_t) 10999998, result.minutes);
+            Assert::AreEqual(H_WEST, result.hemisphere);
+
+            degreesE7ToAngularCoordinate(-1, true, &result);
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 0, result.degrees);
+            Assert::AreEqual((fixedPointW2F6_t) 6, result.minutes);
+            Assert::AreEqual(H_SOUTH, result.hemisphere);
+        }
+
+        TEST_METHOD(Valid_round_trip_with_int32_degrees)
+        {
+            AngularCoordinate result;
+
+            degreesE7ToAngularCoordinate(-1799999995, false, &result);
+            Assert::AreEqual(-180000000, angularCoordinateToInt32Degrees(result));
+
+            degreesE7ToAngularCoordinate(899999994, true, &result);
+            Assert::AreEqual(89999999, angularCoordinateToInt32Degrees(result));
+        }
+
+        TEST_METHOD(Invalid_out_of_range)
+        {
+            AngularCoordinate result;
+
+            degreesE7ToAngularCoordinate(900000001, true, &result);
+            Assert::IsFalse(result.isValid);
+
+            degreesE7ToAngularCoordinate(INT32_MIN, false, &result);
+            Assert::IsFalse(result.isValid);
+        }
+    };
+}
@@ -0,0 +1,65 @@
+#include "..\..\stdafx.h"
+
+#include "gps_conversions_test.h"
+
+namespace gps_conversions_test
+{
+    TEST_CLASS(gps_conversions_test_gpsWeekTimeToUtc)
+    {
+        TEST_METHOD(Valid_gps_epoch)
+        {
+            gpsWeekTimeToUtc(GPS_WEEK_ERA_START, 0, 0, &time, &date);
+            ASSERT_UTC(2019, 4, 7, 0, 0, 0);
+
+            gpsWeekTimeToUtc(GPS_WEEK_ROLLOVER, 0, 0, &time, &date);
+            ASSERT_UTC(1999, 8, 22, 0, 0, 0);
+        }
+
+        TEST_METHOD(Valid_10_bit_week_is_in_current_era)
+        {
+            gpsWeekTimeToUtc(2, 0, 0, &time, &date);
+            ASSERT_UTC(2019, 4, 21, 0, 0, 0);
+        }
+
+        TEST_METHOD(Valid_leap_day_with_leap_seconds)
+        {
+            gpsWeekTimeToUtc(2303, 39091400, GPS_UTC_LEAP_SECONDS, &time, &date);
+            ASSERT_UTC(2024, 2, 29, 12, 34, 5600);
+        }
+
+        TEST_METHOD(Valid_leap_seconds_move_to_previous_week_and_year)
+        {
+            gpsWeekTimeToUtc(1930, 1700, GPS_UTC_LEAP_SECONDS, &time, &date);
+            ASSERT_UTC(2016, 12, 31, 23, 59, 5900);
+        }
+
+        TEST_METHOD(Valid_hundredths_of_second_are_kept)
+        {
+            gpsWeekTimeToUtc(GPS_WEEK_ERA_START, 4321, 0, &time, &date);
+            ASSERT_UTC(2019, 4, 7, 0, 0, 4321);
+        }
+
+        TEST_METHOD(Invalid_time_of_week_is_too_big)
+        {
+            gpsWeekTimeToUtc(GPS_WEEK_ERA_START, GPS_SECONDS_PER_WEEK * 100, 0, &time, &date);
+
+            Assert::IsFalse(time.isValid);
+            Assert::IsFalse(date.isValid);
+        }
+
+        void ASSERT_UTC(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, fixedPointW2F2_t seconds)
+        {
+            Assert::IsTrue(date.isValid);
+            Assert::AreEqual(year, date.year);
+            Assert::AreEqual(month, date.month);
+            Assert::AreEqual(day, date.day);
+            Assert::IsTrue(time.isValid);
+            Assert::AreEqual(hours, time.hours);
+            Assert::AreEqual(minutes, time.minutes);
+            Assert::AreEqual(seconds, time.seconds);
+        }
+
+        GpsTime time;
+        GpsDate date;
+    };
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+extern "C"
+{
+    #include <gps_conversions.h>
+}
@@ -0,0 +1,48 @@
+#include "..\..\stdafx.h"
+
+#include "gps_conversions_test.h"
+
+namespace gps_conversions_test
+{
+    TEST_CLASS(gps_conversions_test_horizontalVelocityToGpvtg)
+    {
+        TEST_METHOD(Valid_cardinal_directions)
+        {
+            GpvtgData result;
+
+            horizontalVelocityToGpvtg(0.0f, 10.0f, &result);
+            Assert::AreEqual((fixedPointW3F1_t) 0, result.trueCourseDegrees);
+            Assert::AreEqual((fixedPointW3F1_t) 360, result.speedKph);
+
+            horizontalVelocityToGpvtg(10.0f, 0.0f, &result);
+            Assert::AreEqual((fixedPointW3F1_t) 900, result.trueCourseDegrees);
+
+            horizontalVelocityToGpvtg(0.0f, -1.0f, &result);
+            Assert::AreEqual((fixedPointW3F1_t) 1800, result.trueCourseDegrees);
+            Assert::AreEqual((fixedPointW3F1_t) 36, result.speedKph);
+
+            horizontalVelocityToGpvtg(-1.0f, 0.0f, &result);
+            Assert::AreEqual((fixedPointW3F1_t) 2700, result.trueCourseDegrees);
+        }
+
+        TEST_METHOD(Valid_course_is_rounded_below_360)
+        {
+            GpvtgData result;
+
+            horizontalVelocityToGpvtg(-3.0f, 4.0f, &result);
+            Assert::AreEqual((fixedPointW3F1_t) 3231, result.trueCourseDegrees);
+            Assert::AreEqual((fixedPointW3F1_t) 180, result.speedKph);
+
+            horizontalVelocityToGpvtg(-0.0001f, 10.0f, &result);
+            Assert::AreEqual((fixedPointW3F1_t) 0, result.trueCourseDegrees);
+        }
+
+        TEST_METHOD(Valid_speed_saturates)
+        {
+            GpvtgData result;
+
+            horizontalVelocityToGpvtg(0.0f, 2000.0f, &result);
+            Assert::AreEqual((fixedPointW3F1_t) 65535, result.speedKph);
+        }
+    };
+}
@@ -0,0 +1,20 @@
+#include "..\..\stdafx.h"
+
+#include "gps_conversions_test.h"
+
+namespace gps_conversions_test
+{
+    TEST_CLASS(gps_conversions_test_readBigEndianDouble)
+    {
+        TEST_METHOD(Valid_ieee_754_values)
+        {
+            static const uint8_t one[] = { 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+            static const uint8_t pi[] = { 0x40, 0x09, 0x21, 0xFB, 0x54, 0x44, 0x2D, 0x18 };
+            static const uint8_t minusTwo[] = { 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+            Assert::AreEqual(1.0, readBigEndianDouble(one));
+            Assert::AreEqual(3.141592653589793, readBigEndianDouble(pi));
+            Assert::AreEqual(-2.0, readBigEndianDouble(minusTwo));
+        }
+    };
+}
@@ -0,0 +1,20 @@
+#include "..\..\stdafx.h"
+
+#include "gps_conversions_test.h"
+
+namespace gps_conversions_test
+{
+    TEST_CLASS(gps_conversions_test_readBigEndianFloat)
+    {
+        TEST_METHOD(Valid_ieee_754_values)
+        {
+            static const uint8_t one[] = { 0x3F, 0x80, 0x00, 0x00 };
+            static const uint8_t minusOneAndHalf[] = { 0xBF, 0xC0, 0x00, 0x00 };
+            static const uint8_t timeOfWeek[] = { 0x48, 0xBE, 0xE1, 0x40 };
+
+            Assert::AreEqual(1.0f, readBigEndianFloat(one));
+            Assert::AreEqual(-1.5f, readBigEndianFloat(minusOneAndHalf));
+            Assert::AreEqual(390922.0f, readBigEndianFloat(timeOfWeek));
+        }
+    };
+}
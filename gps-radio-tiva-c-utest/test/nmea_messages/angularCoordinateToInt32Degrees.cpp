@@ -2,6 +2,8 @@
 
 #include "nmea_messages_test.h"
 
+#include <math.h>
+
 namespace nmea_messages_test
 {
     TEST_CLASS(nmea_messages_test_angularCoordinateToInt32Degrees), private NmeaTest
@@ -23,7 +25,79 @@ namespace nmea_messages_test
             coord.minutes = 47310000;
             coord.hemisphere = H_EAST;
             coord.isValid = true;
-            Assert::AreEqual(120788496, angularCoordinateToInt32Degrees(coord));
+            Assert::AreEqual(120788500, angularCoordinateToInt32Degrees(coord));
+        }
+
+        TEST_METHOD(Should_keep_all_digits_of_latitude)
+        {
+            Assert::AreEqual(47123456, angularCoordinateToInt32Degrees(MAKE_COORDINATE(47, 7407360, H_NORTH)));
+            Assert::AreEqual(89999999, angularCoordinateToInt32Degrees(MAKE_COORDINATE(89, 59999940, H_NORTH)));
+        }
+
+        TEST_METHOD(Should_round_to_nearest_micro_degree)
+        {
+            Assert::AreEqual(0, angularCoordinateToInt32Degrees(MAKE_COORDINATE(0, 29, H_NORTH)));
+            Assert::AreEqual(1, angularCoordinateToInt32Degrees(MAKE_COORDINATE(0, 30, H_NORTH)));
+            Assert::AreEqual(1, angularCoordinateToInt32Degrees(MAKE_COORDINATE(0, 89, H_NORTH)));
+            Assert::AreEqual(2, angularCoordinateToInt32Degrees(MAKE_COORDINATE(0, 90, H_NORTH)));
+            Assert::AreEqual(181000000, angularCoordinateToInt32Degrees(MAKE_COORDINATE(180, 59999999, H_EAST)));
+        }
+
+        TEST_METHOD(Should_be_negative_for_southern_and_western_hemispheres)
+        {
+            Assert::AreEqual(47123456, angularCoordinateToInt32Degrees(MAKE_COORDINATE(47, 7407360, H_NORTH)));
+            Assert::AreEqual(-47123456, angularCoordinateToInt32Degrees(MAKE_COORDINATE(47, 7407360, H_SOUTH)));
+            Assert::AreEqual(120788500, angularCoordinateToInt32Degrees(MAKE_COORDINATE(120, 47310000, H_EAST)));
+            Assert::AreEqual(-120788500, angularCoordinateToInt32Degrees(MAKE_COORDINATE(120, 47310000, H_WEST)));
+        }
+
+        TEST_METHOD(Should_match_exact_conversion_for_every_minutes_value)
+        {
+            // every minutes value of a single degree, both signs
+
+            for (uint32_t minutes = 0; minutes < 60000000; ++minutes)
+            {
+                const int32_t expected = EXACT_MICRO_DEGREES(179, minutes);
+
+                if (angularCoordinateToInt32Degrees(MAKE_COORDINATE(179, minutes, H_EAST)) != expected ||
+                    angularCoordinateToInt32Degrees(MAKE_COORDINATE(179, minutes, H_WEST)) != -expected)
+                {
+                    Assert::AreEqual(expected, angularCoordinateToInt32Degrees(MAKE_COORDINATE(179, minutes, H_EAST)));
+                    Assert::AreEqual(-expected, angularCoordinateToInt32Degrees(MAKE_COORDINATE(179, minutes, H_WEST)));
+                }
+            }
+        }
+
+        TEST_METHOD(Should_match_exact_conversion_for_every_degrees_value)
+        {
+            for (uint32_t degrees = 0; degrees <= 180; ++degrees)
+            {
+                for (uint32_t minutes = degrees; minutes < 60000000; minutes += 9973)
+                {
+                    const int32_t expected = EXACT_MICRO_DEGREES((uint8_t) degrees, minutes);
+
+                    if (angularCoordinateToInt32Degrees(MAKE_COORDINATE((uint8_t) degrees, minutes, H_NORTH)) != expected)
+                    {
+                        Assert::AreEqual(expected, angularCoordinateToInt32Degrees(MAKE_COORDINATE((uint8_t) degrees, minutes, H_NORTH)));
+                    }
+                }
+            }
+        }
+
+        static AngularCoordinate MAKE_COORDINATE(uint8_t degrees, uint32_t minutes, HEMISPHERE hemisphere)
+        {
+            AngularCoordinate coord;
+            coord.degrees = degrees;
+            coord.minutes = minutes;
+            coord.hemisphere = hemisphere;
+            coord.isValid = true;
+            return coord;
+        }
+
+        // reference in double precision which holds every value exactly, ties are rounded up
+        static int32_t EXACT_MICRO_DEGREES(uint8_t degrees, uint32_t minutes)
+        {
+            return (int32_t) floor(degrees * 1000000.0 + minutes / 60.0 + 0.5);
         }
     };
 }
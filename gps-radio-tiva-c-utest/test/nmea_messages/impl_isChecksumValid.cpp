@@ -0,0 +1,58 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_impl_isChecksumValid), private NmeaTest
+    {
+        TEST_METHOD(Valid_checksum_is_xor_of_characters_between_dollar_and_asterisk)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n"), &tokens));
+
+            Assert::AreEqual((uint8_t) 0x47, tokens.checksum);
+            Assert::IsTrue(::isChecksumValid(&tokens));
+        }
+
+        TEST_METHOD(Valid_lower_case_hex_digits)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,,,,,,,,*5a"), &tokens));
+            Assert::IsFalse(::isChecksumValid(&tokens));
+
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,8,,,,,,,*6a"), &tokens));
+            Assert::AreEqual((uint8_t) 0x6A, tokens.checksum);
+            Assert::IsTrue(::isChecksumValid(&tokens));
+        }
+
+        TEST_METHOD(Valid_checksum_of_characters_not_aligned_to_words)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$A*41"), &tokens));
+            Assert::IsTrue(::isChecksumValid(&tokens));
+
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$ABCDEFGHI*41"), &tokens));
+            Assert::IsTrue(::isChecksumValid(&tokens));
+        }
+
+        TEST_METHOD(Invalid_wrong_checksum)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*48"), &tokens));
+
+            Assert::AreEqual((uint8_t) 0x47, tokens.checksum);
+            Assert::IsFalse(::isChecksumValid(&tokens));
+        }
+
+        TEST_METHOD(Invalid_missing_or_incomplete_checksum)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,,,,,,,,"), &tokens));
+            Assert::IsFalse(::isChecksumValid(&tokens));
+
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,,,,,,,,*5"), &tokens));
+            Assert::IsFalse(::isChecksumValid(&tokens));
+
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,,,,,,,,*5G"), &tokens));
+            Assert::IsFalse(::isChecksumValid(&tokens));
+        }
+
+        NmeaTokens tokens;
+    };
+}
@@ -0,0 +1,55 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_impl_parseCharacter), private NmeaTest
+    {
+        TEST_METHOD(Invalid_start_after_zero_length)
+        {
+            uint8_t result;
+            Assert::AreEqual(NPR_UNEXPECTED_END_OF_MESSAGE, ::parseCharacter(MAKE_CONTEXT("", 10), &result));
+            Assert::AreEqual(10U, context.tokenStartIdx);
+        }
+
+        TEST_METHOD(Invalid_no_separator_until_end_of_message)
+        {
+            uint8_t result;
+            Assert::AreEqual(NPR_UNEXPECTED_END_OF_MESSAGE, ::parseCharacter(MAKE_CONTEXT("A", 0), &result));
+            Assert::AreEqual(1U, context.tokenStartIdx);
+        }
+
+        TEST_METHOD(Valid_empty_value)
+        {
+            uint8_t result = 'A';
+            Assert::AreEqual(NPR_EMPTY_VALUE, ::parseCharacter(MAKE_CONTEXT(",A", 0), &result));
+            Assert::AreEqual(1U, context.tokenStartIdx);
+            Assert::AreEqual((uint8_t) 0, result);
+        }
+
+        TEST_METHOD(Valid_character)
+        {
+            uint8_t result;
+            Assert::AreEqual(NPR_VALID, ::parseCharacter(MAKE_CONTEXT("A,V", 0), &result));
+            Assert::AreEqual(2U, context.tokenStartIdx);
+            Assert::AreEqual((uint8_t) 'A', result);
+        }
+
+        TEST_METHOD(Valid_character_followed_by_checksum)
+        {
+            uint8_t result;
+            Assert::AreEqual(NPR_VALID, ::parseCharacter(MAKE_CONTEXT("V*", 0), &result));
+            Assert::AreEqual(2U, context.tokenStartIdx);
+            Assert::AreEqual((uint8_t) 'V', result);
+        }
+
+        TEST_METHOD(Invalid_more_than_one_character)
+        {
+            uint8_t result;
+            Assert::AreEqual(NPR_UNEXPECTED_CHARACTER_ENCOUNTERED, ::parseCharacter(MAKE_CONTEXT("AV,", 0), &result));
+            Assert::AreEqual(3U, context.tokenStartIdx);
+            Assert::AreEqual((uint8_t) 0, result);
+        }
+    };
+}
@@ -0,0 +1,111 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_impl_parseGpgsaFields), private NmeaTest
+    {
+        TEST_METHOD(Valid_fully_filled_message)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSA,A,3,16,18,,22,24,,,,,,,,2.5,1.3,2.1*3C", &result);
+
+            Assert::AreEqual((uint8_t) 3, result.gpgsaData.fixMode);
+            Assert::AreEqual((uint8_t) 16, result.gpgsaData.usedPrns[0]);
+            Assert::AreEqual((uint8_t) 18, result.gpgsaData.usedPrns[1]);
+            Assert::AreEqual((uint8_t) 0, result.gpgsaData.usedPrns[2]);
+            Assert::AreEqual((uint8_t) 22, result.gpgsaData.usedPrns[3]);
+            Assert::AreEqual((uint8_t) 24, result.gpgsaData.usedPrns[4]);
+            Assert::AreEqual((uint8_t) 0, result.gpgsaData.usedPrns[11]);
+            Assert::AreEqual((fixedPointW2F2_t) 250, result.gpgsaData.pdop);
+            Assert::AreEqual((fixedPointW2F2_t) 130, result.gpgsaData.hdop);
+            Assert::AreEqual((fixedPointW2F2_t) 210, result.gpgsaData.vdop);
+        }
+
+        TEST_METHOD(Valid_satellites_in_table_are_marked_as_used)
+        {
+            GpsData result = { 0 };
+            result.satellites.satellitesCount = 2;
+            result.satellites.satellites[0].prn = 16;
+            result.satellites.satellites[1].prn = 17;
+            result.satellites.satellites[1].isUsed = true;
+
+            PARSE("$GPGSA,A,3,16,18,,22,24,,,,,,,,2.5,1.3,2.1*3C", &result);
+
+            Assert::IsTrue(result.satellites.satellites[0].isUsed);
+            Assert::IsFalse(result.satellites.satellites[1].isUsed);
+        }
+
+        TEST_METHOD(Invalid_missing_vdop_doesnt_update_data)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSA,A,3,16,18,,22,24,,,,,,,,2.5,1.3*3D", &result);
+
+            Assert::AreEqual((uint8_t) 0, result.gpgsaData.fixMode);
+            Assert::AreEqual((fixedPointW2F2_t) 0, result.gpgsaData.hdop);
+        }
+
+        TEST_METHOD(Valid_run_of_sentences_is_merged)
+        {
+            GpsData result = { 0 };
+
+            PARSE_MESSAGE("$GNGSA,A,3,16,18,22,24,,,,,,,,,1.8,1.0,1.5*28", &result);
+            PARSE_MESSAGE("$GNGSA,A,3,65,66,72,,,,,,,,,,1.8,1.0,1.5*26", &result);
+
+            Assert::AreEqual((uint8_t) 16, result.gpgsaData.usedPrns[0]);
+            Assert::AreEqual((uint8_t) 24, result.gpgsaData.usedPrns[3]);
+            Assert::AreEqual((uint8_t) 65, result.gpgsaData.usedPrns[4]);
+            Assert::AreEqual((uint8_t) 66, result.gpgsaData.usedPrns[5]);
+            Assert::AreEqual((uint8_t) 72, result.gpgsaData.usedPrns[6]);
+            Assert::AreEqual((uint8_t) 0, result.gpgsaData.usedPrns[7]);
+            Assert::AreEqual((fixedPointW2F2_t) 100, result.gpgsaData.hdop);
+        }
+
+        TEST_METHOD(Valid_satellites_of_all_sentences_of_run_are_marked_as_used)
+        {
+            GpsData result = { 0 };
+            result.satellites.satellitesCount = 3;
+            result.satellites.satellites[0].prn = 16;
+            result.satellites.satellites[1].prn = 66;
+            result.satellites.satellites[2].prn = 67;
+
+            PARSE_MESSAGE("$GNGSA,A,3,16,18,22,24,,,,,,,,,1.8,1.0,1.5*28", &result);
+            PARSE_MESSAGE("$GNGSA,A,3,65,66,72,,,,,,,,,,1.8,1.0,1.5*26", &result);
+
+            Assert::IsTrue(result.satellites.satellites[0].isUsed);
+            Assert::IsTrue(result.satellites.satellites[1].isUsed);
+            Assert::IsFalse(result.satellites.satellites[2].isUsed);
+        }
+
+        TEST_METHOD(Valid_next_run_replaces_used_satellites)
+        {
+            GpsData result = { 0 };
+
+            PARSE_MESSAGE("$GNGSA,A,3,16,18,22,24,,,,,,,,,1.8,1.0,1.5*28", &result);
+            PARSE_MESSAGE("$GNGSA,A,3,65,66,72,,,,,,,,,,1.8,1.0,1.5*26", &result);
+            PARSE_MESSAGE("$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48", &result);
+            PARSE_MESSAGE("$GNGSA,A,3,10,12,,,,,,,,,,,2.1,1.2,1.7*28", &result);
+
+            Assert::AreEqual((uint8_t) 10, result.gpgsaData.usedPrns[0]);
+            Assert::AreEqual((uint8_t) 12, result.gpgsaData.usedPrns[1]);
+            Assert::AreEqual((uint8_t) 0, result.gpgsaData.usedPrns[2]);
+            Assert::AreEqual((uint8_t) 0, result.gpgsaData.usedPrns[4]);
+            Assert::AreEqual((fixedPointW2F2_t) 120, result.gpgsaData.hdop);
+        }
+
+        void PARSE(const char* messageText, GpsData* pResult)
+        {
+            NmeaTokens tokens;
+            Assert::IsTrue(tokenizeMessage(MAKE_MESSAGE(messageText), &tokens));
+            ::parseGpgsaFields(&tokens, pResult);
+        }
+
+        void PARSE_MESSAGE(const char* messageText, GpsData* pResult)
+        {
+            Assert::AreEqual((int) NMR_PARSED, (int) ::parseNmeaMessage(MAKE_MESSAGE(messageText), pResult));
+        }
+    };
+}
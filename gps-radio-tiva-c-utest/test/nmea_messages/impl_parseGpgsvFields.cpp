@@ -0,0 +1,198 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_impl_parseGpgsvFields), private NmeaTest
+    {
+        TEST_METHOD(Valid_sequence_is_assembled_into_satellite_table)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74", &result);
+            PARSE("$GPGSV,3,2,11,14,25,170,00,16,57,208,39,18,67,296,40,19,40,246,00*74", &result);
+
+            Assert::AreEqual((uint8_t) 0, result.satellites.satellitesCount); // sequence isn't complete yet
+
+            PARSE("$GPGSV,3,3,11,22,42,067,42,24,14,311,43,27,05,244,00,,,,*4D", &result);
+
+            Assert::AreEqual((uint8_t) 11, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 11, result.satellites.satellitesInViewCount);
+            Assert::AreEqual((uint8_t) 4, result.satellites.trackedSatellitesCount);
+            Assert::AreEqual((uint8_t) 41, result.satellites.meanSnrDbHz); // (39 + 40 + 42 + 43) / 4, untracked ones are skipped
+            Assert::AreEqual((uint8_t) 43, result.satellites.maxSnrDbHz);
+
+            Assert::AreEqual((uint8_t) 3, result.satellites.satellites[0].prn);
+            Assert::AreEqual((uint8_t) 3, result.satellites.satellites[0].elevationDegrees);
+            Assert::AreEqual((uint16_t) 111, result.satellites.satellites[0].azimuthDegrees);
+            Assert::AreEqual((uint8_t) 0, result.satellites.satellites[0].snrDbHz);
+            Assert::AreEqual((uint8_t) 16, result.satellites.satellites[5].prn);
+            Assert::AreEqual((uint8_t) 57, result.satellites.satellites[5].elevationDegrees);
+            Assert::AreEqual((uint16_t) 208, result.satellites.satellites[5].azimuthDegrees);
+            Assert::AreEqual((uint8_t) 39, result.satellites.satellites[5].snrDbHz);
+            Assert::AreEqual((uint8_t) 27, result.satellites.satellites[10].prn);
+        }
+
+        TEST_METHOD(Valid_last_part_with_fields_cut_off)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74", &result);
+            PARSE("$GPGSV,3,2,11,14,25,170,00,16,57,208,39,18,67,296,40,19,40,246,00*74", &result);
+            PARSE("$GPGSV,3,3,11,22,42,067,42,24,14,311,43,27,05,244,00*4D", &result);
+
+            Assert::AreEqual((uint8_t) 11, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 43, result.satellites.maxSnrDbHz);
+        }
+
+        TEST_METHOD(Valid_signal_id_after_last_satellite_is_ignored)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSV,1,1,02,16,57,208,39,18,67,296,40,1*62", &result);
+
+            Assert::AreEqual((uint8_t) 2, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 18, result.satellites.satellites[1].prn);
+            Assert::AreEqual((uint8_t) 0, result.satellites.satellites[2].prn);
+        }
+
+        TEST_METHOD(Valid_no_satellites_in_view)
+        {
+            GpsData result = { 0 };
+            result.satellites.satellitesCount = 2;
+            result.satellites.satellitesInViewCount = 2;
+            result.satellites.maxSnrDbHz = 40;
+
+            PARSE("$GPGSV,1,1,00*79", &result);
+
+            Assert::AreEqual((uint8_t) 0, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 0, result.satellites.satellitesInViewCount);
+            Assert::AreEqual((uint8_t) 0, result.satellites.maxSnrDbHz);
+            Assert::AreEqual((uint8_t) 0, result.satellites.meanSnrDbHz);
+        }
+
+        TEST_METHOD(Invalid_sequence_with_lost_part_is_dropped)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74", &result);
+            PARSE("$GPGSV,3,3,11,22,42,067,42,24,14,311,43,27,05,244,00*4D", &result);
+
+            Assert::AreEqual((uint8_t) 0, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 0, result.satellites.nextGpgsvMessageNumber);
+        }
+
+        TEST_METHOD(Invalid_sequence_without_first_part_is_dropped)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSV,2,2,11,14,25,170,00,16,57,208,39,18,67,296,40,19,40,246,00*75", &result);
+
+            Assert::AreEqual((uint8_t) 0, result.satellites.satellitesCount);
+        }
+
+        TEST_METHOD(Invalid_field_drops_part)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSV,1,1,02,16,57,208,39,18,67,296,4a*2E", &result);
+
+            Assert::AreEqual((uint8_t) 0, result.satellites.satellitesCount);
+        }
+
+        TEST_METHOD(Valid_satellites_used_in_fix_are_marked)
+        {
+            GpsData result = { 0 };
+            result.gpgsaData.usedPrns[0] = 18;
+
+            PARSE("$GPGSV,1,1,02,16,57,208,39,18,67,296,40,1*62", &result);
+
+            Assert::IsFalse(result.satellites.satellites[0].isUsed);
+            Assert::IsTrue(result.satellites.satellites[1].isUsed);
+        }
+
+        TEST_METHOD(Valid_sequences_of_different_talkers_are_appended)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSV,2,1,06,03,03,111,00,04,15,270,41,06,01,010,00,13,06,292,35*70", &result);
+            PARSE("$GPGSV,2,2,06,14,25,170,00,16,57,208,39*7E", &result);
+
+            Assert::AreEqual((uint8_t) 6, result.satellites.satellitesCount);
+
+            PARSE("$GLGSV,1,1,03,65,20,100,30,66,45,200,44,72,10,300,00*51", &result);
+
+            Assert::AreEqual((uint8_t) 9, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 9, result.satellites.satellitesInViewCount);
+            Assert::AreEqual((uint8_t) 5, result.satellites.trackedSatellitesCount);
+            Assert::AreEqual((uint8_t) 37, result.satellites.meanSnrDbHz); // (41 + 35 + 39 + 30 + 44) / 5
+            Assert::AreEqual((uint8_t) 44, result.satellites.maxSnrDbHz);
+
+            Assert::AreEqual((uint8_t) 3, result.satellites.satellites[0].prn);
+            Assert::AreEqual((uint8_t) 16, result.satellites.satellites[5].prn);
+            Assert::AreEqual((uint8_t) 65, result.satellites.satellites[6].prn);
+            Assert::AreEqual((uint8_t) 72, result.satellites.satellites[8].prn);
+        }
+
+        TEST_METHOD(Valid_interleaved_talkers_dont_overwrite_each_other_in_next_cycle)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSV,2,1,06,03,03,111,00,04,15,270,41,06,01,010,00,13,06,292,35*70", &result);
+            PARSE("$GPGSV,2,2,06,14,25,170,00,16,57,208,39*7E", &result);
+            PARSE("$GLGSV,1,1,03,65,20,100,30,66,45,200,44,72,10,300,00*51", &result);
+
+            // GPS starts the next cycle, GLONASS sends more satellites this time
+
+            PARSE("$GPGSV,2,1,06,03,03,111,00,04,15,270,41,06,01,010,00,13,06,292,35*70", &result);
+            PARSE("$GPGSV,2,2,06,14,25,170,00,16,57,208,39*7E", &result);
+
+            Assert::AreEqual((uint8_t) 6, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 6, result.satellites.satellitesInViewCount);
+
+            PARSE("$GLGSV,2,1,05,65,20,100,30,66,45,200,44,72,10,300,00,73,05,050,20*62", &result);
+            PARSE("$GLGSV,2,2,05,74,33,120,25*57", &result);
+
+            Assert::AreEqual((uint8_t) 11, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 11, result.satellites.satellitesInViewCount);
+            Assert::AreEqual((uint8_t) 16, result.satellites.satellites[5].prn);
+            Assert::AreEqual((uint8_t) 65, result.satellites.satellites[6].prn);
+            Assert::AreEqual((uint8_t) 74, result.satellites.satellites[10].prn);
+        }
+
+        TEST_METHOD(Invalid_sequence_interrupted_by_other_talker_is_dropped)
+        {
+            GpsData result = { 0 };
+
+            PARSE("$GPGSV,2,1,06,03,03,111,00,04,15,270,41,06,01,010,00,13,06,292,35*70", &result);
+            PARSE("$GLGSV,1,1,03,65,20,100,30,66,45,200,44,72,10,300,00*51", &result);
+            PARSE("$GPGSV,2,2,06,14,25,170,00,16,57,208,39*7E", &result);
+
+            Assert::AreEqual((uint8_t) 3, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 65, result.satellites.satellites[0].prn);
+            Assert::AreEqual((uint8_t) 0, result.satellites.nextGpgsvMessageNumber);
+        }
+
+        TEST_METHOD(Valid_part_past_table_doesnt_wrap_to_its_start)
+        {
+            GpsData result = { 0 };
+            result.satellites.satellites[0].prn = 3;
+            result.satellites.nextGpgsvMessageNumber = 65;
+            result.satellites.gpgsvTalkerIdx = gnssTalkerIdx(NMEA_TALKER_ID('G', 'P'));
+
+            PARSE("$GPGSV,65,65,255,14,25,170,00,16,57,208,39,18,67,296,40,19,40,246,00*47", &result);
+
+            Assert::AreEqual((uint8_t) 3, result.satellites.satellites[0].prn);
+            Assert::AreEqual((uint8_t) 32, result.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 255, result.satellites.satellitesInViewCount);
+        }
+
+        void PARSE(const char* messageText, GpsData* pResult)
+        {
+            NmeaTokens tokens;
+            Assert::IsTrue(tokenizeMessage(MAKE_MESSAGE(messageText), &tokens));
+            ::parseGpgsvFields(&tokens, pResult);
+        }
+    };
+}
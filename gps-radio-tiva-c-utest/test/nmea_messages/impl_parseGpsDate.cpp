@@ -0,0 +1,123 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_impl_parseGpsDate), private NmeaTest
+    {
+        TEST_METHOD(Invalid_start_after_zero_length)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_UNEXPECTED_END_OF_MESSAGE, ::parseGpsDate(MAKE_CONTEXT("", 10), &result));
+            Assert::AreEqual(10U, context.tokenStartIdx);
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_no_separator_until_end_of_message)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_UNEXPECTED_END_OF_MESSAGE, ::parseGpsDate(MAKE_CONTEXT("230394", 0), &result));
+            Assert::AreEqual(6U, context.tokenStartIdx);
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Valid_empty_value)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_EMPTY_VALUE, ::parseGpsDate(MAKE_CONTEXT(",", 0), &result));
+            Assert::AreEqual(1U, context.tokenStartIdx);
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Valid_empty_value_followed_by_checksum)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_EMPTY_VALUE, ::parseGpsDate(MAKE_CONTEXT("*", 0), &result));
+            Assert::AreEqual(1U, context.tokenStartIdx);
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Valid_normal_date)
+        {
+            GpsDate result;
+            Assert::AreEqual(NPR_VALID, ::parseGpsDate(MAKE_CONTEXT("230394,", 0), &result));
+            Assert::AreEqual(7U, context.tokenStartIdx);
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 23, result.day);
+            Assert::AreEqual((uint8_t) 3, result.month);
+            Assert::AreEqual((uint16_t) 2094, result.year);
+        }
+
+        TEST_METHOD(Valid_date_followed_by_checksum)
+        {
+            GpsDate result;
+            Assert::AreEqual(NPR_VALID, ::parseGpsDate(MAKE_CONTEXT("161026*", 0), &result));
+            Assert::AreEqual(7U, context.tokenStartIdx);
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 16, result.day);
+            Assert::AreEqual((uint8_t) 10, result.month);
+            Assert::AreEqual((uint16_t) 2026, result.year);
+        }
+
+        TEST_METHOD(Invalid_not_enough_digits_in_day)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_NOT_ENOUGH_DIGITS, ::parseGpsDate(MAKE_CONTEXT("1,", 0), &result));
+            Assert::AreEqual(2U, context.tokenStartIdx);
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_not_enough_digits_in_year)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_NOT_ENOUGH_DIGITS, ::parseGpsDate(MAKE_CONTEXT("23039,", 0), &result));
+            Assert::AreEqual(6U, context.tokenStartIdx);
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_too_many_digits_in_year)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_INVALID_FORMAT, ::parseGpsDate(MAKE_CONTEXT("2303011,", 0), &result));
+            Assert::AreEqual(8U, context.tokenStartIdx);
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_unexpected_character)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_UNEXPECTED_CHARACTER_ENCOUNTERED, ::parseGpsDate(MAKE_CONTEXT("2a0394,", 0), &result));
+            Assert::AreEqual(7U, context.tokenStartIdx);
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_day_out_of_range)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_OVERFLOW, ::parseGpsDate(MAKE_CONTEXT("320394,", 0), &result));
+            Assert::IsFalse(result.isValid);
+            Assert::AreEqual(NPR_OVERFLOW, ::parseGpsDate(MAKE_CONTEXT("000394,", 0), &result));
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_month_out_of_range)
+        {
+            GpsDate result;
+            result.isValid = true;
+            Assert::AreEqual(NPR_OVERFLOW, ::parseGpsDate(MAKE_CONTEXT("231394,", 0), &result));
+            Assert::IsFalse(result.isValid);
+            Assert::AreEqual(NPR_OVERFLOW, ::parseGpsDate(MAKE_CONTEXT("230094,", 0), &result));
+            Assert::IsFalse(result.isValid);
+        }
+    };
+}
@@ -0,0 +1,98 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    struct SchemaTestData
+    {
+        GpsTime time;
+        AngularCoordinate latitude;
+        HEMISPHERE hemisphere;
+        uint8_t count;
+        GPS_FIX_TYPE fixType;
+        uint16_t speed;
+        uint32_t altitude;
+    };
+
+    #define SCHEMA_TEST_FIELDS(FIELD) \
+        FIELD(SchemaTestData, SCHEMA_TEST_ALTITUDE,   9, NFT_FIXED_POINT_UINT32, 1, altitude) \
+        FIELD(SchemaTestData, SCHEMA_TEST_TIME,       1, NFT_GPS_TIME,           0, time) \
+        FIELD(SchemaTestData, SCHEMA_TEST_LATITUDE,   2, NFT_LATITUDE,           0, latitude) \
+        FIELD(SchemaTestData, SCHEMA_TEST_HEMISPHERE, 5, NFT_HEMISPHERE,         0, hemisphere) \
+        FIELD(SchemaTestData, SCHEMA_TEST_FIX_TYPE,   6, NFT_FIX_TYPE,           0, fixType) \
+        FIELD(SchemaTestData, SCHEMA_TEST_COUNT,      7, NFT_UINT8,              0, count) \
+        FIELD(SchemaTestData, SCHEMA_TEST_SPEED,      8, NFT_FIXED_POINT_UINT16, 2, speed)
+
+    enum SCHEMA_TEST_FIELD
+    {
+        SCHEMA_TEST_FIELDS(NMEA_FIELD_INDEX)
+    };
+
+    static const NmeaFieldSchema SCHEMA_TEST_SCHEMA[] =
+    {
+        SCHEMA_TEST_FIELDS(NMEA_FIELD_SCHEMA)
+    };
+
+    TEST_CLASS(nmea_messages_impl_parseSchemaFields), private NmeaTest
+    {
+        TEST_METHOD(Valid_should_parse_listed_fields_in_any_order)
+        {
+            SchemaTestData result = { 0 };
+
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPXXX,123519,4807.038,N,01131.000,W,2,08,0.9,545.4,M*00"), &tokens));
+            Assert::IsTrue(::parseSchemaFields(&tokens, SCHEMA_TEST_SCHEMA, NMEA_SCHEMA_LEN(SCHEMA_TEST_SCHEMA), &result));
+
+            Assert::IsTrue(result.time.isValid);
+            Assert::AreEqual((uint8_t) 12, result.time.hours);
+            Assert::IsTrue(result.latitude.isValid);
+            Assert::AreEqual((uint8_t) 48, result.latitude.degrees);
+            Assert::AreEqual(H_NORTH, result.latitude.hemisphere);
+            Assert::AreEqual(H_WEST, result.hemisphere);
+            Assert::AreEqual(GPSFT_DGPS, result.fixType);
+            Assert::AreEqual((uint8_t) 8, result.count);
+            Assert::AreEqual((uint16_t) 90, result.speed);
+            Assert::AreEqual((uint32_t) 5454, result.altitude);
+        }
+
+        TEST_METHOD(Valid_empty_fields_default_to_0)
+        {
+            SchemaTestData result;
+            memset(&result, 0xFF, sizeof(result));
+
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPXXX,,,,,,,,,,M*00"), &tokens));
+            Assert::IsTrue(::parseSchemaFields(&tokens, SCHEMA_TEST_SCHEMA, NMEA_SCHEMA_LEN(SCHEMA_TEST_SCHEMA), &result));
+
+            Assert::IsFalse(result.time.isValid);
+            Assert::IsFalse(result.latitude.isValid);
+            Assert::AreEqual(H_UNKNOWN, result.hemisphere);
+            Assert::AreEqual(GPSFT_INVALID, result.fixType);
+            Assert::AreEqual((uint8_t) 0, result.count);
+            Assert::AreEqual((uint16_t) 0, result.speed);
+            Assert::AreEqual((uint32_t) 0, result.altitude);
+        }
+
+        TEST_METHOD(Invalid_should_stop_at_invalid_field)
+        {
+            SchemaTestData result = { 0 };
+
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPXXX,993519,4807.038,N,01131.000,W,2,08,0.9,545.4,M*00"), &tokens));
+            Assert::IsFalse(::parseSchemaFields(&tokens, SCHEMA_TEST_SCHEMA, NMEA_SCHEMA_LEN(SCHEMA_TEST_SCHEMA), &result));
+
+            // fields are parsed in schema order
+            Assert::AreEqual((uint32_t) 5454, result.altitude);
+            Assert::IsFalse(result.time.isValid);
+            Assert::IsFalse(result.latitude.isValid);
+        }
+
+        TEST_METHOD(Invalid_listed_field_is_missing)
+        {
+            SchemaTestData result = { 0 };
+
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPXXX,123519,4807.038,N*00"), &tokens));
+            Assert::IsFalse(::parseSchemaFields(&tokens, SCHEMA_TEST_SCHEMA, NMEA_SCHEMA_LEN(SCHEMA_TEST_SCHEMA), &result));
+        }
+
+        NmeaTokens tokens;
+    };
+}
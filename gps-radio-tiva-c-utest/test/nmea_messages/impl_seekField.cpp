@@ -0,0 +1,44 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_impl_seekField), private NmeaTest
+    {
+        TEST_METHOD(Valid_should_move_context_to_start_of_the_field)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,054.7,T,,M*48"), &tokens));
+
+            Assert::AreEqual(NPR_VALID, ::seekField(&tokens, 2, &context));
+            Assert::IsTrue(&message == context.pMessage);
+            Assert::AreEqual(13U, context.tokenStartIdx);
+
+            Assert::AreEqual(NPR_VALID, ::seekField(&tokens, 3, &context));
+            Assert::AreEqual(15U, context.tokenStartIdx);
+
+            Assert::AreEqual(NPR_VALID, ::seekField(&tokens, 0, &context));
+            Assert::AreEqual(0U, context.tokenStartIdx);
+        }
+
+        TEST_METHOD(Valid_field_can_be_parsed_after_seek)
+        {
+            uint16_t result;
+
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,054.7,T,034.4,M*48"), &tokens));
+
+            Assert::AreEqual(NPR_VALID, ::seekField(&tokens, 3, &context));
+            Assert::AreEqual(NPR_VALID, ::parseUInt16FixedPoint(&context, 0, 1, &result));
+            Assert::AreEqual((uint16_t) 344, result);
+        }
+
+        TEST_METHOD(Invalid_field_is_not_in_message)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,054.7"), &tokens));
+
+            Assert::AreEqual(NPR_UNEXPECTED_END_OF_MESSAGE, ::seekField(&tokens, 2, &context));
+        }
+
+        NmeaTokens tokens;
+    };
+}
@@ -0,0 +1,41 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_impl_sentenceTypeId), private NmeaTest
+    {
+        TEST_METHOD(Valid_same_id_for_all_gnss_talkers)
+        {
+            const uint32_t expectedId = NMEA_SENTENCE_TYPE_ID('G', 'G', 'A');
+
+            Assert::AreEqual(expectedId, ::sentenceTypeId(MAKE_MESSAGE("$GPGGA,")));
+            Assert::AreEqual(expectedId, ::sentenceTypeId(MAKE_MESSAGE("$GNGGA,")));
+            Assert::AreEqual(expectedId, ::sentenceTypeId(MAKE_MESSAGE("$GLGGA,")));
+            Assert::AreEqual(expectedId, ::sentenceTypeId(MAKE_MESSAGE("$GAGGA")));
+        }
+
+        TEST_METHOD(Valid_different_ids_for_different_sentences)
+        {
+            Assert::AreEqual(NMEA_SENTENCE_TYPE_ID('V', 'T', 'G'), ::sentenceTypeId(MAKE_MESSAGE("$GPVTG,")));
+            Assert::AreEqual(NMEA_SENTENCE_TYPE_ID('R', 'M', 'C'), ::sentenceTypeId(MAKE_MESSAGE("$GNRMC,")));
+            Assert::AreNotEqual(NMEA_SENTENCE_TYPE_ID('G', 'G', 'A'), ::sentenceTypeId(MAKE_MESSAGE("$GPGSA,")));
+        }
+
+        TEST_METHOD(Invalid_unknown_talker_or_short_header)
+        {
+            Assert::AreEqual((uint32_t) NMEA_UNKNOWN_SENTENCE_TYPE_ID, ::sentenceTypeId(MAKE_MESSAGE("$PSRF1")));
+            Assert::AreEqual((uint32_t) NMEA_UNKNOWN_SENTENCE_TYPE_ID, ::sentenceTypeId(MAKE_MESSAGE("$GPGG")));
+            Assert::AreEqual((uint32_t) NMEA_UNKNOWN_SENTENCE_TYPE_ID, ::sentenceTypeId(MAKE_MESSAGE("#GPGGA")));
+        }
+
+        TEST_METHOD(Valid_parser_is_found_only_for_supported_sentences)
+        {
+            Assert::IsTrue(::parseGpggaFields == ::findSentenceParser(NMEA_SENTENCE_TYPE_ID('G', 'G', 'A'))->parseFields);
+            Assert::IsTrue(::parseGpvtgFields == ::findSentenceParser(NMEA_SENTENCE_TYPE_ID('V', 'T', 'G'))->parseFields);
+            Assert::IsNull(::findSentenceParser(NMEA_UNKNOWN_SENTENCE_TYPE_ID));
+            Assert::IsNull(::findSentenceParser(NMEA_SENTENCE_TYPE_ID('X', 'X', 'X')));
+        }
+    };
+}
@@ -0,0 +1,66 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_impl_tokenizeMessage), private NmeaTest
+    {
+        TEST_METHOD(Valid_should_index_start_of_every_field_and_checksum)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,054.7,T,,M,005.5,N,010.2,K*48"), &tokens));
+
+            const uint8_t expectedFieldStartIdx[] = { 0, 7, 13, 15, 16, 18, 24, 26, 32 };
+
+            Assert::IsTrue(&message == tokens.pMessage);
+            Assert::AreEqual((uint8_t) sizeof(expectedFieldStartIdx), tokens.fieldsCount);
+            Assert::AreEqual(0, memcmp(expectedFieldStartIdx, tokens.fieldStartIdx, sizeof(expectedFieldStartIdx)));
+            Assert::AreEqual((uint8_t) 33, tokens.checksumIdx);
+        }
+
+        TEST_METHOD(Valid_should_find_separators_at_every_position_within_a_word)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GP,,,,a,ab,abc,abcd,abcde,*"), &tokens));
+
+            const uint8_t expectedFieldStartIdx[] = { 0, 4, 5, 6, 7, 9, 12, 16, 21, 27 };
+
+            Assert::AreEqual((uint8_t) sizeof(expectedFieldStartIdx), tokens.fieldsCount);
+            Assert::AreEqual(0, memcmp(expectedFieldStartIdx, tokens.fieldStartIdx, sizeof(expectedFieldStartIdx)));
+            Assert::AreEqual((uint8_t) 27, tokens.checksumIdx);
+        }
+
+        TEST_METHOD(Valid_should_not_index_fields_after_checksum)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG,1*48,2"), &tokens));
+
+            Assert::AreEqual((uint8_t) 2, tokens.fieldsCount);
+            Assert::AreEqual((uint8_t) 8, tokens.checksumIdx);
+        }
+
+        TEST_METHOD(Valid_header_only)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPVTG"), &tokens));
+
+            Assert::AreEqual((uint8_t) 1, tokens.fieldsCount);
+            Assert::AreEqual((uint8_t) 0, tokens.fieldStartIdx[0]);
+            Assert::AreEqual((uint8_t) NMEA_NO_CHECKSUM, tokens.checksumIdx);
+        }
+
+        TEST_METHOD(Valid_should_stop_indexing_at_max_fields_count_but_find_checksum)
+        {
+            Assert::IsTrue(::tokenizeMessage(MAKE_MESSAGE("$GPGSV,,,,,,,,,,,,,,,,,,,,,,,,*48"), &tokens));
+
+            Assert::AreEqual((uint8_t) NMEA_MAX_FIELDS_COUNT, tokens.fieldsCount);
+            Assert::AreEqual((uint8_t) (NMEA_MAX_FIELDS_COUNT + 5), tokens.fieldStartIdx[NMEA_MAX_FIELDS_COUNT - 1]);
+            Assert::AreEqual((uint8_t) 30, tokens.checksumIdx);
+        }
+
+        TEST_METHOD(Invalid_nullptr)
+        {
+            Assert::IsFalse(::tokenizeMessage(nullptr, &tokens));
+            Assert::IsFalse(::tokenizeMessage(MAKE_MESSAGE("$GPVTG"), nullptr));
+        }
+
+        NmeaTokens tokens;
+    };
+}
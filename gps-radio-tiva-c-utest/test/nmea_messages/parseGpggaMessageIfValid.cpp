@@ -9,7 +9,7 @@ namespace nmea_messages_test
         TEST_METHOD(Valid_fully_filled_message)
         {
             GpsData result = { 0 };
-            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47"), &result);
+            Assert::IsTrue(parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47"), &result));
 
             Assert::IsTrue(result.isValid);
 
@@ -36,7 +36,7 @@ namespace nmea_messages_test
         TEST_METHOD(Valid_message_without_time)
         {
             GpsData result = { 0 };
-            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47"), &result);
+            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*4A"), &result);
 
             Assert::IsTrue(result.isValid);
 
@@ -60,7 +60,7 @@ namespace nmea_messages_test
         TEST_METHOD(Valid_without_number_of_sattelites)
         {
             GpsData result = { 0 };
-            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,,0.9,54512.4,M,46.9,M,,*47"), &result);
+            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,,0.9,54512.4,M,46.9,M,,*4C"), &result);
 
             Assert::IsTrue(result.isValid);
 
@@ -87,7 +87,7 @@ namespace nmea_messages_test
         TEST_METHOD(Valid_without_altitude)
         {
             GpsData result = { 0 };
-            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,,M,46.9,M,,*47"), &result);
+            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,,M,46.9,M,,*69"), &result);
 
             Assert::IsTrue(result.isValid);
 
@@ -114,7 +114,7 @@ namespace nmea_messages_test
         TEST_METHOD(Valid_without_all_mandatory_fields)
         {
             GpsData result = { 0 };
-            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,,4807.038,N,01131.000,E,1,,,,,,,,*47"), &result);
+            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,,4807.038,N,01131.000,E,1,,,,,,,,*5E"), &result);
 
             Assert::IsTrue(result.isValid);
 
@@ -138,7 +138,7 @@ namespace nmea_messages_test
         TEST_METHOD(Invalid_empty_message)
         {
             GpsData result = { 0 };
-            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,,,,,,,,,,,,,,*47"), &result);
+            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,,,,,,,,,,,,,,*56"), &result);
 
             Assert::IsFalse(result.isValid);
         }
@@ -151,10 +151,34 @@ namespace nmea_messages_test
             Assert::IsFalse(result.isValid);
         }
 
+        TEST_METHOD(Invalid_message_with_wrong_checksum)
+        {
+            GpsData result = { 0 };
+            Assert::IsFalse(parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*46"), &result));
+
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_message_with_corrupted_character)
+        {
+            GpsData result = { 0 };
+            Assert::IsFalse(parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,5X5.4,M,46.9,M,,*47"), &result));
+
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_message_without_checksum)
+        {
+            GpsData result = { 0 };
+            Assert::IsFalse(parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,"), &result));
+
+            Assert::IsFalse(result.isValid);
+        }
+
         TEST_METHOD(Invalid_message_without_latitude)
         {
             GpsData result = { 0 };
-            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,,,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47"), &result);
+            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,,,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*17"), &result);
 
             Assert::IsFalse(result.isValid);
         }
@@ -162,7 +186,7 @@ namespace nmea_messages_test
         TEST_METHOD(Invalid_message_without_longitude)
         {
             GpsData result = { 0 };
-            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,1,08,0.9,545.4,M,46.9,M,,*47"), &result);
+            parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,1,08,0.9,545.4,M,46.9,M,,*2E"), &result);
 
             Assert::IsFalse(result.isValid);
         }
@@ -171,43 +195,43 @@ namespace nmea_messages_test
         {
             {
                 GpsData result = { 0 };
-                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,,08,0.9,545.4,M,46.9,M,,*47"), &result);
+                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,,08,0.9,545.4,M,46.9,M,,*1F"), &result);
                 Assert::IsFalse(result.isValid);
             }
 
             {
                 GpsData result = { 0 };
-                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,0,08,0.9,545.4,M,46.9,M,,*47"), &result);
+                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,0,08,0.9,545.4,M,46.9,M,,*2F"), &result);
                 Assert::IsFalse(result.isValid);
             }
 
             {
                 GpsData result = { 0 };
-                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,3,08,0.9,545.4,M,46.9,M,,*47"), &result);
+                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,3,08,0.9,545.4,M,46.9,M,,*2C"), &result);
                 Assert::IsFalse(result.isValid);
             }
 
             {
                 GpsData result = { 0 };
-                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,4,08,0.9,545.4,M,46.9,M,,*47"), &result);
+                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,4,08,0.9,545.4,M,46.9,M,,*2B"), &result);
                 Assert::IsFalse(result.isValid);
             }
 
             {
                 GpsData result = { 0 };
-                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,5,08,0.9,545.4,M,46.9,M,,*47"), &result);
+                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,5,08,0.9,545.4,M,46.9,M,,*2A"), &result);
                 Assert::IsFalse(result.isValid);
             }
 
             {
                 GpsData result = { 0 };
-                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,6,08,0.9,545.4,M,46.9,M,,*47"), &result);
+                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,6,08,0.9,545.4,M,46.9,M,,*29"), &result);
                 Assert::IsFalse(result.isValid);
             }
 
             {
                 GpsData result = { 0 };
-                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,8,08,0.9,545.4,M,46.9,M,,*47"), &result);
+                parseGpggaMessageIfValid(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,,,8,08,0.9,545.4,M,46.9,M,,*27"), &result);
                 Assert::IsFalse(result.isValid);
             }
         }
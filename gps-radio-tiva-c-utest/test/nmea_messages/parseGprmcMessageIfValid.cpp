@@ -0,0 +1,141 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_test_parseGprmcMessageIfValid), private NmeaTest
+    {
+        TEST_METHOD(Valid_fully_filled_message)
+        {
+            GpsData result = { 0 };
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A"), &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::IsTrue(result.gpggaData.utcTime.isValid);
+            Assert::AreEqual((uint8_t) 12, result.gpggaData.utcTime.hours);
+            Assert::AreEqual((uint8_t) 35, result.gpggaData.utcTime.minutes);
+            Assert::AreEqual((fixedPointW2F2_t) 1900, result.gpggaData.utcTime.seconds);
+            Assert::IsTrue(result.gpggaData.latitude.isValid);
+            Assert::AreEqual((uint8_t) 48, result.gpggaData.latitude.degrees);
+            Assert::AreEqual((fixedPointW2F6_t) 7038000, result.gpggaData.latitude.minutes);
+            Assert::AreEqual((int) H_NORTH, (int) result.gpggaData.latitude.hemisphere);
+            Assert::IsTrue(result.gpggaData.longitude.isValid);
+            Assert::AreEqual((uint8_t) 11, result.gpggaData.longitude.degrees);
+            Assert::AreEqual((fixedPointW2F6_t) 31000000, result.gpggaData.longitude.minutes);
+            Assert::AreEqual((int) H_EAST, (int) result.gpggaData.longitude.hemisphere);
+            Assert::AreEqual((fixedPointW3F1_t) 844, result.gpvtgData.trueCourseDegrees);
+            Assert::AreEqual((fixedPointW3F1_t) 415, result.gpvtgData.speedKph); // 22.4 knots
+            Assert::IsTrue(result.utcDate.isValid);
+            Assert::AreEqual((uint8_t) 23, result.utcDate.day);
+            Assert::AreEqual((uint8_t) 3, result.utcDate.month);
+            Assert::AreEqual((uint16_t) 2094, result.utcDate.year);
+        }
+
+        TEST_METHOD(Valid_message_with_mode_field)
+        {
+            GpsData result = { 0 };
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GNRMC,123519.00,A,4807.038,S,01131.000,W,022.4,084.4,230394,,,A*43"), &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((int) H_SOUTH, (int) result.gpggaData.latitude.hemisphere);
+            Assert::AreEqual((int) H_WEST, (int) result.gpggaData.longitude.hemisphere);
+            Assert::IsTrue(result.utcDate.isValid);
+        }
+
+        TEST_METHOD(Valid_keeps_altitude_and_number_of_sattelites_from_gpgga)
+        {
+            GpsData result = { 0 };
+            result.gpggaData.altitudeMslMeters = 5454;
+            result.gpggaData.numberOfSattelitesInUse = 8;
+            result.gpggaData.fixType = GPSFT_GPS;
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A"), &result));
+
+            Assert::AreEqual((fixedPointW5F1_t) 5454, result.gpggaData.altitudeMslMeters);
+            Assert::AreEqual((uint8_t) 8, result.gpggaData.numberOfSattelitesInUse);
+            Assert::AreEqual((int) GPSFT_GPS, (int) result.gpggaData.fixType);
+        }
+
+        TEST_METHOD(Valid_speed_and_course_missing)
+        {
+            GpsData result = { 0 };
+            result.gpvtgData.trueCourseDegrees = 1;
+            result.gpvtgData.speedKph = 1;
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,A,4807.038,N,01131.000,E,,,230394,003.1,W*66"), &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((fixedPointW3F1_t) 0, result.gpvtgData.trueCourseDegrees);
+            Assert::AreEqual((fixedPointW3F1_t) 0, result.gpvtgData.speedKph);
+        }
+
+        TEST_METHOD(Valid_date_missing)
+        {
+            GpsData result = { 0 };
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,*1E"), &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::IsFalse(result.utcDate.isValid);
+        }
+
+        TEST_METHOD(Valid_speed_is_saturated)
+        {
+            GpsData result = { 0 };
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,A,4807.038,N,01131.000,E,6553.5,084.4,230394,003.1,W*5E"), &result));
+
+            Assert::AreEqual((fixedPointW3F1_t) 65535, result.gpvtgData.speedKph);
+        }
+
+        TEST_METHOD(Valid_void_status_doesnt_update_data)
+        {
+            GpsData result = { 0 };
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,V,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*7D"), &result));
+
+            Assert::IsFalse(result.isValid);
+            Assert::IsFalse(result.gpggaData.latitude.isValid);
+            Assert::IsFalse(result.utcDate.isValid);
+        }
+
+        TEST_METHOD(Valid_missing_position_doesnt_update_data)
+        {
+            GpsData result = { 0 };
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,A,,,,,022.4,084.4,230394,003.1,W*53"), &result));
+
+            Assert::IsFalse(result.isValid);
+            Assert::IsFalse(result.utcDate.isValid);
+        }
+
+        TEST_METHOD(Valid_empty)
+        {
+            GpsData result = { 0 };
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,,,,,,,,,,,*67"), &result));
+
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_field_doesnt_update_data)
+        {
+            GpsData result = { 0 };
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,AV,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*3C"), &result));
+            Assert::IsFalse(result.isValid);
+
+            Assert::IsTrue(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,320394,003.1,W*6A"), &result));
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_wrong_checksum)
+        {
+            GpsData result = { 0 };
+            Assert::IsFalse(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6B"), &result));
+
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_missing_checksum)
+        {
+            GpsData result = { 0 };
+            Assert::IsFalse(parseGprmcMessageIfValid(MAKE_MESSAGE("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W"), &result));
+
+            Assert::IsFalse(result.isValid);
+        }
+    };
+}
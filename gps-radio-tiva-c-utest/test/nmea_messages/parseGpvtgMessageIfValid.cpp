@@ -9,7 +9,7 @@ namespace nmea_messages_test
         TEST_METHOD(Valid_fully_filled_message)
         {
             GpsData result = { 0 };
-            parseGpvtgMessageIfValid(MAKE_MESSAGE("$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48"), &result);
+            Assert::IsTrue(parseGpvtgMessageIfValid(MAKE_MESSAGE("$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48"), &result));
 
             Assert::AreEqual((fixedPointW3F1_t) 547, result.gpvtgData.trueCourseDegrees);
             Assert::AreEqual((fixedPointW3F1_t) 102, result.gpvtgData.speedKph);
@@ -18,7 +18,7 @@ namespace nmea_messages_test
         TEST_METHOD(Valid_true_course_missing)
         {
             GpsData result = { 0 };
-            parseGpvtgMessageIfValid(MAKE_MESSAGE("$GPVTG,,T,034.4,M,005.5,N,010.2,K*48"), &result);
+            parseGpvtgMessageIfValid(MAKE_MESSAGE("$GPVTG,,T,034.4,M,005.5,N,010.2,K*60"), &result);
 
             Assert::AreEqual((fixedPointW3F1_t) 0, result.gpvtgData.trueCourseDegrees);
             Assert::AreEqual((fixedPointW3F1_t) 102, result.gpvtgData.speedKph);
@@ -27,7 +27,7 @@ namespace nmea_messages_test
         TEST_METHOD(Valid_speed_missing)
         {
             GpsData result = { 0 };
-            parseGpvtgMessageIfValid(MAKE_MESSAGE("$GPVTG,054.7,T,034.4,M,005.5,N,,K*48"), &result);
+            parseGpvtgMessageIfValid(MAKE_MESSAGE("$GPVTG,054.7,T,034.4,M,005.5,N,,K*65"), &result);
 
             Assert::AreEqual((fixedPointW3F1_t) 547, result.gpvtgData.trueCourseDegrees);
             Assert::AreEqual((fixedPointW3F1_t) 0, result.gpvtgData.speedKph);
@@ -36,7 +36,16 @@ namespace nmea_messages_test
         TEST_METHOD(Valid_empty)
         {
             GpsData result = { 0 };
-            parseGpvtgMessageIfValid(MAKE_MESSAGE("$GPVTG,,,,,,,,*48"), &result);
+            parseGpvtgMessageIfValid(MAKE_MESSAGE("$GPVTG,,,,,,,,*52"), &result);
+
+            Assert::AreEqual((fixedPointW3F1_t) 0, result.gpvtgData.trueCourseDegrees);
+            Assert::AreEqual((fixedPointW3F1_t) 0, result.gpvtgData.speedKph);
+        }
+
+        TEST_METHOD(Invalid_wrong_checksum)
+        {
+            GpsData result = { 0 };
+            Assert::IsFalse(parseGpvtgMessageIfValid(MAKE_MESSAGE("$GPVTG,054.7,T,034.4,M,005.5,N,910.2,K*48"), &result));
 
             Assert::AreEqual((fixedPointW3F1_t) 0, result.gpvtgData.trueCourseDegrees);
             Assert::AreEqual((fixedPointW3F1_t) 0, result.gpvtgData.speedKph);
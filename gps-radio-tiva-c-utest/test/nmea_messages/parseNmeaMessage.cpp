@@ -0,0 +1,95 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_messages_test.h"
+
+namespace nmea_messages_test
+{
+    TEST_CLASS(nmea_messages_test_parseNmeaMessage), private NmeaTest
+    {
+        TEST_METHOD(Valid_gga_from_gps_talker)
+        {
+            GpsData result = { 0 };
+            Assert::AreEqual((int) NMR_PARSED, (int) parseNmeaMessage(MAKE_MESSAGE("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47"), &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 48, result.gpggaData.latitude.degrees);
+            Assert::AreEqual((fixedPointW5F1_t) 5454, result.gpggaData.altitudeMslMeters);
+        }
+
+        TEST_METHOD(Valid_gga_from_multi_gnss_talker)
+        {
+            GpsData result = { 0 };
+            Assert::AreEqual((int) NMR_PARSED, (int) parseNmeaMessage(MAKE_MESSAGE("$GNGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*59"), &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 11, result.gpggaData.longitude.degrees);
+        }
+
+        TEST_METHOD(Valid_vtg_from_glonass_talker)
+        {
+            GpsData result = { 0 };
+            Assert::AreEqual((int) NMR_PARSED, (int) parseNmeaMessage(MAKE_MESSAGE("$GLVTG,054.7,T,034.4,M,005.5,N,010.2,K*54"), &result));
+
+            Assert::AreEqual((fixedPointW3F1_t) 547, result.gpvtgData.trueCourseDegrees);
+            Assert::AreEqual((fixedPointW3F1_t) 102, result.gpvtgData.speedKph);
+        }
+
+        TEST_METHOD(Valid_rmc_alone_fills_gps_data)
+        {
+            GpsData result = { 0 };
+            Assert::AreEqual((int) NMR_PARSED, (int) parseNmeaMessage(MAKE_MESSAGE("$GNRMC,123519.00,A,4807.038,S,01131.000,W,022.4,084.4,230394,,,A*43"), &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 48, result.gpggaData.latitude.degrees);
+            Assert::AreEqual((uint8_t) 11, result.gpggaData.longitude.degrees);
+            Assert::AreEqual((fixedPointW3F1_t) 844, result.gpvtgData.trueCourseDegrees);
+            Assert::AreEqual((uint8_t) 23, result.utcDate.day);
+        }
+
+        TEST_METHOD(Valid_zda_fills_time_and_date)
+        {
+            GpsData result = { 0 };
+            Assert::AreEqual((int) NMR_PARSED, (int) parseNmeaMessage(MAKE_MESSAGE("$GPZDA,201530.00,04,07,2026,00,00*66"), &result));
+
+            Assert::IsTrue(result.gpggaData.utcTime.isValid);
+            Assert::AreEqual((uint8_t) 20, result.gpggaData.utcTime.hours);
+            Assert::AreEqual((uint8_t) 15, result.gpggaData.utcTime.minutes);
+            Assert::AreEqual((fixedPointW2F2_t) 3000, result.gpggaData.utcTime.seconds);
+            Assert::IsTrue(result.utcDate.isValid);
+            Assert::AreEqual((uint8_t) 4, result.utcDate.day);
+            Assert::AreEqual((uint8_t) 7, result.utcDate.month);
+            Assert::AreEqual((uint16_t) 2026, result.utcDate.year);
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_empty_or_wrong_zda_doesnt_update_date)
+        {
+            GpsData result = { 0 };
+            Assert::AreEqual((int) NMR_PARSED, (int) parseNmeaMessage(MAKE_MESSAGE("$GNZDA,,,,,00,00*56"), &result));
+            Assert::AreEqual((int) NMR_PARSED, (int) parseNmeaMessage(MAKE_MESSAGE("$GPZDA,201530.00,04,13,2026,00,00*63"), &result));
+
+            Assert::IsFalse(result.gpggaData.utcTime.isValid);
+            Assert::IsFalse(result.utcDate.isValid);
+        }
+
+        TEST_METHOD(Invalid_wrong_checksum_is_rejected)
+        {
+            GpsData result = { 0 };
+            Assert::AreEqual((int) NMR_REJECTED, (int) parseNmeaMessage(MAKE_MESSAGE("$GNGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47"), &result));
+
+            Assert::IsFalse(result.isValid);
+        }
+
+        TEST_METHOD(Invalid_unknown_sentence_or_talker_is_not_supported)
+        {
+            GpsData result = { 0 };
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) parseNmeaMessage(MAKE_MESSAGE("$GPXXX,123519*47"), &result));
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) parseNmeaMessage(MAKE_MESSAGE("$PSRFGGA,123519*47"), &result));
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) parseNmeaMessage(MAKE_MESSAGE("$GPGG"), &result));
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) parseNmeaMessage(MAKE_MESSAGE("GPGGA,123519*47"), &result));
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) parseNmeaMessage(nullptr, &result));
+
+            Assert::IsFalse(result.isValid);
+        }
+    };
+}
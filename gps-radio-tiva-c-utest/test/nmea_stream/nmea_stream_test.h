@@ -0,0 +1,88 @@
+#pragma once
+
+extern "C"
+{
+    #include <nmea_stream_impl.h>
+}
+
+class NmeaStreamTest
+{
+    protected:
+        NMEA_MESSAGE_RESULT FEED(NmeaStreamParser* pParser, const char* text)
+        {
+            NMEA_MESSAGE_RESULT result = NMR_NOT_SUPPORTED;
+
+            for (; *text; ++text)
+            {
+                const NMEA_MESSAGE_RESULT characterResult = parseNmeaCharacter(pParser, (uint8_t) *text);
+                if (characterResult != NMR_NOT_SUPPORTED)
+                {
+                    result = characterResult;
+                }
+            }
+
+            return result;
+        }
+
+        // compares members one by one as structures have padding, values of invalid time and
+        // coordinates are left undefined by the parsers
+        void ASSERT_GPS_DATA_EQUAL(const GpsData& expected, const GpsData& actual)
+        {
+            Assert::AreEqual(expected.isValid, actual.isValid);
+            ASSERT_GPS_TIME_EQUAL(expected.gpggaData.utcTime, actual.gpggaData.utcTime);
+            ASSERT_ANGULAR_COORDINATE_EQUAL(expected.gpggaData.latitude, actual.gpggaData.latitude);
+            ASSERT_ANGULAR_COORDINATE_EQUAL(expected.gpggaData.longitude, actual.gpggaData.longitude);
+            Assert::AreEqual(expected.gpggaData.altitudeMslMeters, actual.gpggaData.altitudeMslMeters);
+            Assert::AreEqual((int) expected.gpggaData.fixType, (int) actual.gpggaData.fixType);
+            Assert::AreEqual(expected.gpggaData.numberOfSattelitesInUse, actual.gpggaData.numberOfSattelitesInUse);
+            Assert::AreEqual(expected.gpvtgData.trueCourseDegrees, actual.gpvtgData.trueCourseDegrees);
+            Assert::AreEqual(expected.gpvtgData.speedKph, actual.gpvtgData.speedKph);
+            ASSERT_GPS_DATE_EQUAL(expected.utcDate, actual.utcDate);
+            Assert::AreEqual(expected.gpgsaData.fixMode, actual.gpgsaData.fixMode);
+            Assert::AreEqual(0, memcmp(expected.gpgsaData.usedPrns, actual.gpgsaData.usedPrns, sizeof(expected.gpgsaData.usedPrns)));
+            Assert::AreEqual(expected.gpgsaData.pdop, actual.gpgsaData.pdop);
+            Assert::AreEqual(expected.gpgsaData.hdop, actual.gpgsaData.hdop);
+            Assert::AreEqual(expected.gpgsaData.vdop, actual.gpgsaData.vdop);
+            Assert::AreEqual(expected.satellites.satellitesCount, actual.satellites.satellitesCount);
+            Assert::AreEqual(expected.satellites.satellitesInViewCount, actual.satellites.satellitesInViewCount);
+            Assert::AreEqual(expected.satellites.meanSnrDbHz, actual.satellites.meanSnrDbHz);
+            Assert::AreEqual(expected.satellites.maxSnrDbHz, actual.satellites.maxSnrDbHz);
+            Assert::AreEqual(0, memcmp(expected.satellites.satellites, actual.satellites.satellites, sizeof(expected.satellites.satellites)));
+        }
+
+        void ASSERT_GPS_DATE_EQUAL(const GpsDate& expected, const GpsDate& actual)
+        {
+            Assert::AreEqual(expected.isValid, actual.isValid);
+            if (!expected.isValid)
+            {
+                return;
+            }
+            Assert::AreEqual(expected.day, actual.day);
+            Assert::AreEqual(expected.month, actual.month);
+            Assert::AreEqual(expected.year, actual.year);
+        }
+
+        void ASSERT_GPS_TIME_EQUAL(const GpsTime& expected, const GpsTime& actual)
+        {
+            Assert::AreEqual(expected.isValid, actual.isValid);
+            if (!expected.isValid)
+            {
+                return;
+            }
+            Assert::AreEqual(expected.hours, actual.hours);
+            Assert::AreEqual(expected.minutes, actual.minutes);
+            Assert::AreEqual(expected.seconds, actual.seconds);
+        }
+
+        void ASSERT_ANGULAR_COORDINATE_EQUAL(const AngularCoordinate& expected, const AngularCoordinate& actual)
+        {
+            Assert::AreEqual(expected.isValid, actual.isValid);
+            if (!expected.isValid)
+            {
+                return;
+            }
+            Assert::AreEqual(expected.degrees, actual.degrees);
+            Assert::AreEqual(expected.minutes, actual.minutes);
+            Assert::AreEqual((int) expected.hemisphere, (int) actual.hemisphere);
+        }
+};
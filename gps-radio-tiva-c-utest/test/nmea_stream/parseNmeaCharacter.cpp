@@ -0,0 +1,171 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_stream_test.h"
+
+namespace nmea_stream_test
+{
+    TEST_CLASS(nmea_stream_test_parseNmeaCharacter), private NmeaStreamTest
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            initializeNmeaStreamParser(&parser);
+        }
+
+        TEST_METHOD(Should_parse_gga_and_vtg_into_gps_data)
+        {
+            Assert::AreEqual((int) NMR_PARSED, (int) FEED(&parser, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n"));
+            Assert::AreEqual((int) NMR_PARSED, (int) FEED(&parser, "$GNVTG,054.7,T,034.4,M,005.5,N,010.2,K*56\r\n"));
+
+            Assert::IsTrue(parser.gpsData.isValid);
+            Assert::IsTrue(parser.gpsData.gpggaData.utcTime.isValid);
+            Assert::AreEqual((uint8_t) 12, parser.gpsData.gpggaData.utcTime.hours);
+            Assert::AreEqual((uint8_t) 35, parser.gpsData.gpggaData.utcTime.minutes);
+            Assert::AreEqual((uint16_t) 1900, parser.gpsData.gpggaData.utcTime.seconds);
+            Assert::AreEqual((int) H_NORTH, (int) parser.gpsData.gpggaData.latitude.hemisphere);
+            Assert::AreEqual((uint8_t) 48, parser.gpsData.gpggaData.latitude.degrees);
+            Assert::AreEqual((uint32_t) 7038000, parser.gpsData.gpggaData.latitude.minutes);
+            Assert::AreEqual((int) H_EAST, (int) parser.gpsData.gpggaData.longitude.hemisphere);
+            Assert::AreEqual((uint8_t) 11, parser.gpsData.gpggaData.longitude.degrees);
+            Assert::AreEqual((uint32_t) 31000000, parser.gpsData.gpggaData.longitude.minutes);
+            Assert::AreEqual((int) GPSFT_GPS, (int) parser.gpsData.gpggaData.fixType);
+            Assert::AreEqual((uint8_t) 8, parser.gpsData.gpggaData.numberOfSattelitesInUse);
+            Assert::AreEqual((uint32_t) 5454, parser.gpsData.gpggaData.altitudeMslMeters);
+            Assert::AreEqual((uint16_t) 547, parser.gpsData.gpvtgData.trueCourseDegrees);
+            Assert::AreEqual((uint16_t) 102, parser.gpsData.gpvtgData.speedKph);
+        }
+
+        TEST_METHOD(Should_produce_same_gps_data_as_message_parser)
+        {
+            const char* sentences[] =
+            {
+                "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47",
+                "$GPGGA,,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*68",
+                "$GPGGA,235959.99,8959.999999,S,17959.9999999,W,2,,0.9,54512.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.038,N,01131.000,E,1,,0.9,54512.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.038,n,01131.000,w,7,08,0.9,,M,46.9,M,,*00",
+                "$GPGGA,,,,,,,,,,,,,,*00",
+                "$GPGGA,123519,4807.038,N,,,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.038,,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.038,NN,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,9107.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.038,N,30031.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4860.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,480,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.0.38,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,12351,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,243519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,12a519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.038,N,01131.000,E,256,08,0.9,545.4,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,4294967295,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,429496729.5,M,46.9,M,,*00",
+                "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9*00",
+                "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4*00",
+                "$GPGGA,123519,4807.038,N,01131.000*00",
+                "$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48",
+                "$GPVTG,,T,034.4,M,005.5,N,,K*00",
+                "$GPVTG,6553.5,T,034.4,M,005.5,N,6553.6,K*00",
+                "$GPVTG,1.25,T,034.4,M,005.5,N,1.,K*00",
+                "$GPVTG,054.7,T,034.4,M,005.5,N*00",
+                "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*00",
+                "$GNRMC,123519.00,A,4807.038,S,01131.000,W,022.4,084.4,230394,,,A*00",
+                "$GPRMC,123519,V,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*00",
+                "$GPRMC,123519,A,,,,,022.4,084.4,230394,003.1,W*00",
+                "$GPRMC,123519,A,4807.038,N,01131.000,E,,,230394,003.1,W*00",
+                "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,*00",
+                "$GPRMC,123519,AV,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*00",
+                "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,320394,003.1,W*00",
+                "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,23039,003.1,W*00",
+                "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394.0,003.1,W*00",
+                "$GPRMC,123519,A,4807.038,N,01131.000,E,6553.5,084.4,230394,003.1,W*00",
+                "$GPRMC,,,,,,,,,,,*00",
+                "$GPGSA,A,3,16,18,,22,24,,,,,,,,2.5,1.3,2.1*00",
+                "$GPGSA,A,3,16,18,,22,24,,,,,,,,2.5,1.3*00",
+                "$GPGSA,A,3,16,18,,22,24,,,,,,,,2.5,1.3,2.1.1*00",
+                "$GPGSV,1,1,02,16,57,208,39,18,67,296,40,1*00",
+                "$GPGSV,1,1,03,16,57,208,39,18,67,296,40,19,40,246,00*00",
+                "$GPGSV,1,1,02,16,57,208,39,18,67,296,4a*00",
+                "$GPGSV,1,1,00*00",
+                "$GPGSV,1,1*00",
+            };
+
+            for (uint8_t i = 0; i < sizeof(sentences) / sizeof(sentences[0]); ++i)
+            {
+                Message message;
+                GpsData expected;
+                memset(&expected, 0, sizeof(expected));
+
+                strcpy_s((char*) message.message, UART_MESSAGE_MAX_LEN, sentences[i]);
+                message.size = (uint8_t) strlen(sentences[i]);
+                withValidChecksum(&message);
+
+                Assert::AreEqual((int) NMR_PARSED, (int) parseNmeaMessage(&message, &expected));
+
+                initializeNmeaStreamParser(&parser);
+                for (uint8_t j = 0; j < message.size; ++j)
+                {
+                    parseNmeaCharacter(&parser, message.message[j]);
+                }
+                Assert::AreEqual((int) NMR_PARSED, (int) FEED(&parser, "\r\n"));
+
+                ASSERT_GPS_DATA_EQUAL(expected, parser.gpsData);
+            }
+        }
+
+        TEST_METHOD(Should_append_gsv_sequences_of_different_talkers)
+        {
+            Assert::AreEqual((int) NMR_PARSED, (int) FEED(&parser, "$GPGSV,2,1,06,03,03,111,00,04,15,270,41,06,01,010,00,13,06,292,35*70\r\n"));
+            Assert::AreEqual((int) NMR_PARSED, (int) FEED(&parser, "$GPGSV,2,2,06,14,25,170,00,16,57,208,39*7E\r\n"));
+            Assert::AreEqual((int) NMR_PARSED, (int) FEED(&parser, "$GLGSV,1,1,03,65,20,100,30,66,45,200,44,72,10,300,00*51\r\n"));
+
+            Assert::AreEqual((uint8_t) 9, parser.gpsData.satellites.satellitesCount);
+            Assert::AreEqual((uint8_t) 16, parser.gpsData.satellites.satellites[5].prn);
+            Assert::AreEqual((uint8_t) 65, parser.gpsData.satellites.satellites[6].prn);
+        }
+
+        TEST_METHOD(Should_reject_sentence_with_wrong_checksum)
+        {
+            Assert::AreEqual((int) NMR_REJECTED, (int) FEED(&parser, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*46\r\n"));
+
+            Assert::IsFalse(parser.gpsData.isValid);
+            Assert::AreEqual((uint32_t) 1, (uint32_t) parser.rejectedCount);
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.publishedCount);
+        }
+
+        TEST_METHOD(Should_reject_truncated_sentence_and_resynchronize_at_next_one)
+        {
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) FEED(&parser, "$GPGGA,123519,4807.0"));
+            Assert::AreEqual((int) NMR_PARSED, (int) FEED(&parser, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n"));
+
+            Assert::IsTrue(parser.gpsData.isValid);
+            Assert::AreEqual((uint32_t) 1, (uint32_t) parser.rejectedCount);
+            Assert::AreEqual((uint32_t) 1, (uint32_t) parser.publishedCount);
+        }
+
+        TEST_METHOD(Should_ignore_unsupported_sentences_and_talkers)
+        {
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) FEED(&parser, "$GPXXX,123519,4807.038,N*00\r\n"));
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) FEED(&parser, "$PSRF,123519,4807.038,N*00\r\n"));
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) FEED(&parser, "$XXGGA,123519,4807.038,N*00\r\n"));
+            Assert::AreEqual((int) NMR_NOT_SUPPORTED, (int) FEED(&parser, "garbage\r\n"));
+
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.rejectedCount);
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.publishedCount);
+        }
+
+        static void withValidChecksum(Message* pMessage)
+        {
+            uint8_t checksum = 0;
+            uint8_t i = 1;
+            for (; pMessage->message[i] != '*'; ++i)
+            {
+                checksum ^= pMessage->message[i];
+            }
+            pMessage->message[i + 1] = "0123456789ABCDEF"[checksum >> 4];
+            pMessage->message[i + 2] = "0123456789ABCDEF"[checksum & 0x0F];
+        }
+
+        NmeaStreamParser parser;
+    };
+}
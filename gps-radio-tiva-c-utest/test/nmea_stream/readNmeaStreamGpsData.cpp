@@ -0,0 +1,53 @@
+#include "..\..\stdafx.h"
+
+#include "nmea_stream_test.h"
+
+namespace nmea_stream_test
+{
+    TEST_CLASS(nmea_stream_test_readNmeaStreamGpsData), private NmeaStreamTest
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            initializeNmeaStreamParser(&parser);
+        }
+
+        TEST_METHOD(Should_return_false_until_something_is_published)
+        {
+            GpsData result;
+
+            Assert::IsFalse(readNmeaStreamGpsData(&parser, &result));
+
+            FEED(&parser, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47");
+            Assert::IsFalse(readNmeaStreamGpsData(&parser, &result));
+        }
+
+        TEST_METHOD(Should_return_latest_published_data_once)
+        {
+            GpsData result = { 0 };
+
+            FEED(&parser, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n");
+            FEED(&parser, "$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48\r\n");
+
+            Assert::IsTrue(readNmeaStreamGpsData(&parser, &result));
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 48, result.gpggaData.latitude.degrees);
+            Assert::AreEqual((uint16_t) 102, result.gpvtgData.speedKph);
+
+            Assert::IsFalse(readNmeaStreamGpsData(&parser, &result));
+        }
+
+        TEST_METHOD(Should_publish_to_the_slot_which_was_not_published_last)
+        {
+            GpsData result;
+
+            FEED(&parser, "$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48\r\n");
+            const uint8_t firstIdx = parser.publishedGpsDataIdx;
+            FEED(&parser, "$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48\r\n");
+
+            Assert::AreNotEqual(firstIdx, (uint8_t) parser.publishedGpsDataIdx);
+            Assert::IsTrue(readNmeaStreamGpsData(&parser, &result));
+        }
+
+        NmeaStreamParser parser;
+    };
+}
@@ -0,0 +1,18 @@
+#include "..\..\stdafx.h"
+
+#include "tsip_test.h"
+
+namespace tsip_test
+{
+    TEST_CLASS(tsip_test_createTsipIoOptionsPacket)
+    {
+        TEST_METHOD(Should_select_double_precision_lla_and_enu_velocity)
+        {
+            static const uint8_t expected[] = { 0x10, 0x35, 0x16, 0x02, 0x00, 0x00, 0x10, 0x03 };
+            uint8_t packet[TSIP_IO_OPTIONS_PACKET_MAX_LEN];
+
+            Assert::AreEqual((uint8_t) sizeof(expected), createTsipIoOptionsPacket(packet));
+            Assert::AreEqual(0, memcmp(expected, packet, sizeof(expected)));
+        }
+    };
+}
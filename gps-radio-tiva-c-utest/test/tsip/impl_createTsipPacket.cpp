@@ -0,0 +1,28 @@
+#include "..\..\stdafx.h"
+
+#include "tsip_test.h"
+
+namespace tsip_test
+{
+    TEST_CLASS(tsip_impl_createTsipPacket)
+    {
+        TEST_METHOD(Valid_dle_in_data_is_stuffed)
+        {
+            static const uint8_t data[] = { 0x10, 0x03, 0x10 };
+            static const uint8_t expected[] = { 0x10, 0x8E, 0x10, 0x10, 0x03, 0x10, 0x10, 0x10, 0x03 };
+            uint8_t packet[sizeof(expected)];
+
+            Assert::AreEqual((uint8_t) sizeof(expected), ::createTsipPacket(0x8E, data, sizeof(data), packet));
+            Assert::AreEqual(0, memcmp(expected, packet, sizeof(expected)));
+        }
+
+        TEST_METHOD(Valid_empty_data)
+        {
+            static const uint8_t expected[] = { 0x10, 0x35, 0x10, 0x03 };
+            uint8_t packet[sizeof(expected)];
+
+            Assert::AreEqual((uint8_t) sizeof(expected), ::createTsipPacket(0x35, nullptr, 0, packet));
+            Assert::AreEqual(0, memcmp(expected, packet, sizeof(expected)));
+        }
+    };
+}
@@ -0,0 +1,89 @@
+#include "..\..\stdafx.h"
+
+#include "tsip_test.h"
+
+namespace tsip_test
+{
+    TEST_CLASS(tsip_test_parseTsipByte), private TsipTest
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            initializeTsipParser(&parser);
+        }
+
+        TEST_METHOD(Valid_reports_are_published_with_satellite_selection)
+        {
+            FEED_FIX(&parser, 2374, 464749.0f);
+
+            Assert::AreEqual((uint32_t) 1, (uint32_t) parser.publishedCount);
+            const TsipReports& reports = parser.publishedReports[parser.publishedReportsIdx];
+            Assert::IsTrue(reports.hasGpsTime);
+            Assert::IsTrue(reports.hasPosition);
+            Assert::IsTrue(reports.hasVelocity);
+            Assert::AreEqual((uint8_t) (TSIP_ALL_IN_VIEW_MIN_LEN + 9), reports.allInViewLen);
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.rejectedCount);
+        }
+
+        TEST_METHOD(Valid_stuffed_dle_is_unstuffed)
+        {
+            // week 0x0910
+            FEED_FIX(&parser, 2320, 464749.0f);
+
+            const TsipReports& reports = parser.publishedReports[parser.publishedReportsIdx];
+            Assert::AreEqual((uint8_t) 0x09, reports.gpsTime[TSIP_GPS_TIME_WEEK]);
+            Assert::AreEqual((uint8_t) 0x10, reports.gpsTime[TSIP_GPS_TIME_WEEK + 1]);
+            Assert::AreEqual((uint8_t) 0x00, reports.gpsTime[TSIP_GPS_TIME_UTC_OFFSET + 3]);
+        }
+
+        TEST_METHOD(Valid_io_options_report_confirms_tsip_output)
+        {
+            static const uint8_t other[] = { 0x02, 0x02, 0x00, 0x00 };
+            static const uint8_t ioOptions[] = { TSIP_IO_OPTIONS_POSITION, TSIP_IO_OPTIONS_VELOCITY, 0x00, 0x00 };
+
+            Assert::IsTrue(FEED_PACKET(&parser, TSIP_IO_OPTIONS_REPORT_ID, other, sizeof(other)));
+            Assert::IsFalse(parser.isTsipOutputConfirmed);
+
+            Assert::IsTrue(FEED_PACKET(&parser, TSIP_IO_OPTIONS_REPORT_ID, ioOptions, sizeof(ioOptions)));
+            Assert::IsTrue(parser.isTsipOutputConfirmed);
+        }
+
+        TEST_METHOD(Valid_start_is_found_after_nmea)
+        {
+            static const uint8_t nmea[] = "$GPGGA,123519,4807.038,N*00\r\n";
+            static const uint8_t ioOptions[] = { 0x10, 0x55, 0x16, 0x02, 0x00, 0x00, 0x10, 0x03 };
+
+            Assert::IsFalse(FEED(&parser, nmea, sizeof(nmea) - 1));
+            Assert::IsTrue(FEED(&parser, ioOptions, sizeof(ioOptions)));
+            Assert::IsTrue(parser.isTsipOutputConfirmed);
+        }
+
+        TEST_METHOD(Valid_long_packets_are_skipped)
+        {
+            uint8_t data[TSIP_MAX_DATA_LEN + 1] = { 0 };
+
+            Assert::IsTrue(FEED_PACKET(&parser, 0x8F, data, sizeof(data)));
+            Assert::IsTrue(FEED_PACKET(&parser, TSIP_ALL_IN_VIEW_ID, data, sizeof(data)));
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.publishedCount);
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.rejectedCount);
+        }
+
+        TEST_METHOD(Invalid_unstuffed_dle_starts_next_packet)
+        {
+            static const uint8_t broken[] = { 0x10, 0x41, 0x01, 0x02, 0x10, 0x55, 0x16, 0x02, 0x00, 0x00, 0x10, 0x03 };
+
+            Assert::IsTrue(FEED(&parser, broken, sizeof(broken)));
+            Assert::AreEqual((uint32_t) 1, (uint32_t) parser.rejectedCount);
+            Assert::IsTrue(parser.isTsipOutputConfirmed);
+        }
+
+        TEST_METHOD(Invalid_end_without_start_is_ignored)
+        {
+            static const uint8_t end[] = { 0x10, 0x03, 0x10, 0x10 };
+
+            Assert::IsFalse(FEED(&parser, end, sizeof(end)));
+            Assert::AreEqual((int) TPS_WAITING_FOR_DLE, (int) parser.state);
+        }
+
+        TsipParser parser;
+    };
+}
@@ -0,0 +1,103 @@
+#include "..\..\stdafx.h"
+
+#include "tsip_test.h"
+
+namespace tsip_test
+{
+    TEST_CLASS(tsip_test_readTsipGpsData), private TsipTest
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            initializeTsipParser(&parser);
+            memset(&result, 0, sizeof(result));
+        }
+
+        TEST_METHOD(Should_return_false_until_something_is_published)
+        {
+            Assert::IsFalse(readTsipGpsData(&parser, &result));
+
+            FEED_FIX(&parser, 2374, 464749.0f);
+            Assert::IsTrue(readTsipGpsData(&parser, &result));
+            Assert::IsFalse(readTsipGpsData(&parser, &result));
+        }
+
+        TEST_METHOD(Valid_3d_fix_fills_gps_data)
+        {
+            FEED_FIX(&parser, 2374, 464749.0f);
+            Assert::IsTrue(readTsipGpsData(&parser, &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::IsTrue(result.gpggaData.utcTime.isValid);
+            Assert::AreEqual((uint8_t) 9, result.gpggaData.utcTime.hours);
+            Assert::AreEqual((uint8_t) 5, result.gpggaData.utcTime.minutes);
+            Assert::AreEqual((fixedPointW2F2_t) 3000, result.gpggaData.utcTime.seconds);
+            Assert::IsTrue(result.utcDate.isValid);
+            Assert::AreEqual((uint16_t) 2025, result.utcDate.year);
+            Assert::AreEqual((uint8_t) 7, result.utcDate.month);
+            Assert::AreEqual((uint8_t) 11, result.utcDate.day);
+            Assert::AreEqual((uint8_t) 40, result.gpggaData.latitude.degrees);
+            Assert::AreEqual((fixedPointW2F6_t) 900000, result.gpggaData.latitude.minutes);
+            Assert::AreEqual(H_NORTH, result.gpggaData.latitude.hemisphere);
+            Assert::AreEqual((uint8_t) 105, result.gpggaData.longitude.degrees);
+            Assert::AreEqual((fixedPointW2F6_t) 16230000, result.gpggaData.longitude.minutes);
+            Assert::AreEqual(H_WEST, result.gpggaData.longitude.hemisphere);
+            Assert::AreEqual((fixedPointW5F1_t) 16552, result.gpggaData.altitudeMslMeters);
+            Assert::AreEqual((int) GPSFT_GPS, (int) result.gpggaData.fixType);
+            Assert::AreEqual((uint8_t) 9, result.gpggaData.numberOfSattelitesInUse);
+            Assert::AreEqual((fixedPointW3F1_t) 360, result.gpvtgData.speedKph);
+            Assert::AreEqual((fixedPointW3F1_t) 1431, result.gpvtgData.trueCourseDegrees);
+            Assert::AreEqual((uint8_t) 3, result.gpgsaData.fixMode);
+            Assert::AreEqual((fixedPointW2F2_t) 180, result.gpgsaData.pdop);
+            Assert::AreEqual((fixedPointW2F2_t) 95, result.gpgsaData.hdop);
+            Assert::AreEqual((fixedPointW2F2_t) 152, result.gpgsaData.vdop);
+            Assert::AreEqual((uint8_t) 17, result.gpgsaData.usedPrns[8]);
+            Assert::AreEqual((uint8_t) 0, result.gpgsaData.usedPrns[9]);
+        }
+
+        TEST_METHOD(Valid_time_report_from_the_next_week)
+        {
+            FEED_FIX(&parser, 2375, 0.5f);
+            Assert::IsTrue(readTsipGpsData(&parser, &result));
+
+            Assert::AreEqual((uint8_t) 11, result.utcDate.day);
+            Assert::AreEqual((uint8_t) 9, result.gpggaData.utcTime.hours);
+        }
+
+        TEST_METHOD(Valid_no_fix_keeps_the_last_position)
+        {
+            FEED_FIX(&parser, 2374, 464749.0f);
+            Assert::IsTrue(readTsipGpsData(&parser, &result));
+
+            // position which wasn't computed by receiver
+            uint8_t position[TSIP_DOUBLE_LLA_POSITION_LEN] = { 0 };
+            WRITE_FLOAT(position + TSIP_POSITION_TIME_OF_FIX, -1.0f);
+            FEED_PACKET(&parser, TSIP_DOUBLE_LLA_POSITION_ID, position, sizeof(position));
+            FEED_ALL_IN_VIEW(&parser, 0);
+            Assert::IsTrue(readTsipGpsData(&parser, &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 40, result.gpggaData.latitude.degrees);
+            Assert::AreEqual((uint8_t) 1, result.gpgsaData.fixMode);
+        }
+
+        TEST_METHOD(Invalid_time_is_unknown_without_time_report)
+        {
+            uint8_t position[TSIP_DOUBLE_LLA_POSITION_LEN] = { 0 };
+            WRITE_DOUBLE(position + TSIP_POSITION_LATITUDE, -0.5);
+            WRITE_FLOAT(position + TSIP_POSITION_TIME_OF_FIX, 100.0f);
+            FEED_PACKET(&parser, TSIP_DOUBLE_LLA_POSITION_ID, position, sizeof(position));
+            FEED_ALL_IN_VIEW(&parser, TSIP_DIMENSION_2D);
+            Assert::IsTrue(readTsipGpsData(&parser, &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::IsFalse(result.gpggaData.utcTime.isValid);
+            Assert::IsFalse(result.utcDate.isValid);
+            Assert::AreEqual(H_SOUTH, result.gpggaData.latitude.hemisphere);
+            Assert::AreEqual((uint8_t) 28, result.gpggaData.latitude.degrees);
+            Assert::AreEqual((uint8_t) 2, result.gpgsaData.fixMode);
+        }
+
+        TsipParser parser;
+        GpsData result;
+    };
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+extern "C"
+{
+    #include <tsip_impl.h>
+}
+
+#include "..\binary_protocol_test.h"
+
+class TsipTest : public BinaryProtocolTest<TsipParser, parseTsipByte>
+{
+    protected:
+        bool FEED_PACKET(TsipParser* pParser, uint8_t id, const uint8_t* pData, uint8_t dataLen)
+        {
+            uint8_t packet[2 * TSIP_MAX_DATA_LEN + 4];
+            return FEED(pParser, packet, createTsipPacket(id, pData, dataLen, packet));
+        }
+
+        // 2025-07-11 09:05:30 UTC fix at 40.015 N 105.2705 W, 1655.2 m, moving south-east at 10 m/s
+        void FEED_FIX(TsipParser* pParser, uint16_t week, float timeOfWeek)
+        {
+            uint8_t gpsTime[TSIP_GPS_TIME_LEN];
+            WRITE_FLOAT(gpsTime, timeOfWeek);
+            WRITE_BIG_ENDIAN(gpsTime + TSIP_GPS_TIME_WEEK, week, 2);
+            WRITE_FLOAT(gpsTime + TSIP_GPS_TIME_UTC_OFFSET, 18.0f);
+            FEED_PACKET(pParser, TSIP_GPS_TIME_ID, gpsTime, sizeof(gpsTime));
+
+            uint8_t position[TSIP_DOUBLE_LLA_POSITION_LEN] = { 0 };
+            WRITE_DOUBLE(position + TSIP_POSITION_LATITUDE, 40.015 / TSIP_DEGREES_PER_RADIAN);
+            WRITE_DOUBLE(position + TSIP_POSITION_LONGITUDE, -105.2705 / TSIP_DEGREES_PER_RADIAN);
+            WRITE_DOUBLE(position + TSIP_POSITION_ALTITUDE, 1655.2);
+            WRITE_FLOAT(position + TSIP_POSITION_TIME_OF_FIX, 464748.0f);
+            FEED_PACKET(pParser, TSIP_DOUBLE_LLA_POSITION_ID, position, sizeof(position));
+
+            uint8_t velocity[TSIP_ENU_VELOCITY_LEN] = { 0 };
+            WRITE_FLOAT(velocity + TSIP_VELOCITY_EAST, 6.0f);
+            WRITE_FLOAT(velocity + TSIP_VELOCITY_NORTH, -8.0f);
+            FEED_PACKET(pParser, TSIP_ENU_VELOCITY_ID, velocity, sizeof(velocity));
+
+            FEED_ALL_IN_VIEW(pParser, TSIP_DIMENSION_3D);
+        }
+
+        void FEED_ALL_IN_VIEW(TsipParser* pParser, uint8_t dimension)
+        {
+            uint8_t allInView[TSIP_ALL_IN_VIEW_MIN_LEN + 9] = { 0 };
+            allInView[TSIP_ALL_IN_VIEW_MODE] = (uint8_t) (0x90 | dimension);
+            WRITE_FLOAT(allInView + TSIP_ALL_IN_VIEW_PDOP, 1.8f);
+            WRITE_FLOAT(allInView + TSIP_ALL_IN_VIEW_HDOP, 0.95f);
+            WRITE_FLOAT(allInView + TSIP_ALL_IN_VIEW_VDOP, 1.52f);
+            for (uint8_t i = 0; i < 9; ++i)
+            {
+                allInView[TSIP_ALL_IN_VIEW_PRNS + i] = (uint8_t) (2 * i + 1);
+            }
+            FEED_PACKET(pParser, TSIP_ALL_IN_VIEW_ID, allInView, sizeof(allInView));
+        }
+};
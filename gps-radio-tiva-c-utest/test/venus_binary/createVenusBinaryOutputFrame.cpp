@@ -0,0 +1,18 @@
+#include "..\..\stdafx.h"
+
+#include "venus_binary_test.h"
+
+namespace venus_binary_test
+{
+    TEST_CLASS(venus_binary_test_createVenusBinaryOutputFrame)
+    {
+        TEST_METHOD(Should_configure_binary_message_type_in_sram)
+        {
+            static const uint8_t expected[] = { 0xA0, 0xA1, 0x00, 0x03, 0x09, 0x02, 0x00, 0x0B, 0x0D, 0x0A };
+            uint8_t frame[VENUS_BINARY_OUTPUT_FRAME_LEN];
+
+            Assert::AreEqual((uint8_t) sizeof(expected), createVenusBinaryOutputFrame(frame));
+            Assert::AreEqual(0, memcmp(expected, frame, sizeof(expected)));
+        }
+    };
+}
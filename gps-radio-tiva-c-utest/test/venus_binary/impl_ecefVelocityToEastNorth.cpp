@@ -0,0 +1,33 @@
+#include "..\..\stdafx.h"
+
+#include "venus_binary_test.h"
+
+namespace venus_binary_test
+{
+    TEST_CLASS(venus_binary_impl_ecefVelocityToEastNorth)
+    {
+        TEST_METHOD(Valid_at_equator_and_prime_meridian)
+        {
+            float east, north;
+
+            ::ecefVelocityToEastNorth(7.0f, 5.0f, 3.0f, 0.0f, 0.0f, &east, &north);
+            Assert::AreEqual(5.0f, east, 1e-5f);
+            Assert::AreEqual(3.0f, north, 1e-5f);
+        }
+
+        TEST_METHOD(Valid_rotated_by_longitude_and_latitude)
+        {
+            const float halfPi = 1.57079633f;
+            float east, north;
+
+            ::ecefVelocityToEastNorth(-2.0f, 0.0f, 0.0f, 0.0f, halfPi, &east, &north);
+            Assert::AreEqual(2.0f, east, 1e-5f);
+            Assert::AreEqual(0.0f, north, 1e-5f);
+
+            // at north pole going towards prime meridian is going south
+            ::ecefVelocityToEastNorth(4.0f, 0.0f, 0.0f, halfPi, 0.0f, &east, &north);
+            Assert::AreEqual(0.0f, east, 1e-5f);
+            Assert::AreEqual(-4.0f, north, 1e-5f);
+        }
+    };
+}
@@ -0,0 +1,97 @@
+#include "..\..\stdafx.h"
+
+#include "venus_binary_test.h"
+
+namespace venus_binary_test
+{
+    TEST_CLASS(venus_binary_test_parseVenusBinaryByte), private VenusBinaryTest
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            initializeVenusBinaryParser(&parser);
+        }
+
+        TEST_METHOD(Valid_navigation_data_is_published_at_the_end_of_frame)
+        {
+            uint8_t payload[VENUS_NAVIGATION_DATA_LEN];
+            NAVIGATION_DATA(payload, VFM_3D);
+
+            Assert::IsTrue(FEED_FRAME(&parser, payload, sizeof(payload)));
+
+            Assert::AreEqual((uint32_t) 1, (uint32_t) parser.publishedCount);
+            Assert::AreEqual(0, memcmp(payload, parser.publishedNavigationData[parser.publishedNavigationDataIdx], sizeof(payload)));
+            Assert::IsTrue(parser.isBinaryOutputConfirmed);
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.rejectedCount);
+        }
+
+        TEST_METHOD(Valid_ack_of_configuration_confirms_binary_output)
+        {
+            static const uint8_t nack[] = { VENUS_NACK_ID, VENUS_CONFIGURE_MESSAGE_TYPE_ID };
+            static const uint8_t ack[] = { VENUS_ACK_ID, VENUS_CONFIGURE_MESSAGE_TYPE_ID };
+
+            Assert::IsTrue(FEED_FRAME(&parser, nack, sizeof(nack)));
+            Assert::IsFalse(parser.isBinaryOutputConfirmed);
+
+            Assert::IsTrue(FEED_FRAME(&parser, ack, sizeof(ack)));
+            Assert::IsTrue(parser.isBinaryOutputConfirmed);
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.publishedCount);
+        }
+
+        TEST_METHOD(Valid_start_is_found_after_nmea_and_noise)
+        {
+            static const uint8_t noise[] = { '$', 'G', 'P', 0xA0, 0xA0, '\r', '\n', 0xA0 };
+            static const uint8_t ack[] = { 0xA1, 0x00, 0x02, VENUS_ACK_ID, VENUS_CONFIGURE_MESSAGE_TYPE_ID, 0x8A, 0x0D, 0x0A };
+
+            Assert::IsFalse(FEED(&parser, noise, sizeof(noise)));
+            Assert::IsTrue(FEED(&parser, ack, sizeof(ack)));
+            Assert::IsTrue(parser.isBinaryOutputConfirmed);
+        }
+
+        TEST_METHOD(Valid_long_frames_are_skipped)
+        {
+            uint8_t payload[VENUS_MAX_PAYLOAD_LEN * 2];
+            memset(payload, 0, sizeof(payload));
+            payload[0] = VENUS_NAVIGATION_DATA_ID;
+
+            Assert::IsTrue(FEED_FRAME(&parser, payload, sizeof(payload)));
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.publishedCount);
+            Assert::IsFalse(parser.isBinaryOutputConfirmed);
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.rejectedCount);
+        }
+
+        TEST_METHOD(Invalid_wrong_checksum_or_end_is_rejected)
+        {
+            uint8_t payload[VENUS_NAVIGATION_DATA_LEN];
+            uint8_t frame[VENUS_NAVIGATION_DATA_LEN + VENUS_FRAME_OVERHEAD_LEN];
+            NAVIGATION_DATA(payload, VFM_3D);
+            const uint16_t frameLen = createVenusFrame(payload, sizeof(payload), frame);
+
+            frame[frameLen - 3] ^= 1;
+            Assert::IsFalse(FEED(&parser, frame, frameLen));
+            frame[frameLen - 3] ^= 1;
+            frame[frameLen - 1] = '\r';
+            Assert::IsFalse(FEED(&parser, frame, frameLen));
+
+            Assert::AreEqual((uint32_t) 2, (uint32_t) parser.rejectedCount);
+            Assert::AreEqual((uint32_t) 0, (uint32_t) parser.publishedCount);
+
+            // parser is ready for the next frame
+            frame[frameLen - 1] = VENUS_END_2;
+            Assert::IsTrue(FEED(&parser, frame, frameLen));
+            Assert::AreEqual((uint32_t) 1, (uint32_t) parser.publishedCount);
+        }
+
+        TEST_METHOD(Invalid_empty_or_too_long_payload_is_rejected)
+        {
+            static const uint8_t empty[] = { 0xA0, 0xA1, 0x00, 0x00 };
+            static const uint8_t tooLong[] = { 0xA0, 0xA1, 0xA0, 0xA1 };
+
+            Assert::IsFalse(FEED(&parser, empty, sizeof(empty)));
+            Assert::IsFalse(FEED(&parser, tooLong, sizeof(tooLong)));
+            Assert::AreEqual((uint32_t) 2, (uint32_t) parser.rejectedCount);
+            Assert::AreEqual((int) VFS_WAITING_FOR_START_1, (int) parser.state);
+        }
+
+        VenusBinaryParser parser;
+    };
+}
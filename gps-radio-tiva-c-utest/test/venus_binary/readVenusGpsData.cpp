@@ -0,0 +1,123 @@
+#include "..\..\stdafx.h"
+
+#include "venus_binary_test.h"
+
+#include <stdlib.h>
+
+namespace venus_binary_test
+{
+    TEST_CLASS(venus_binary_test_readVenusGpsData), private VenusBinaryTest
+    {
+        TEST_METHOD_INITIALIZE(SetUp)
+        {
+            initializeVenusBinaryParser(&parser);
+            memset(&result, 0, sizeof(result));
+        }
+
+        TEST_METHOD(Should_return_false_until_something_is_published)
+        {
+            uint8_t payload[VENUS_NAVIGATION_DATA_LEN];
+            NAVIGATION_DATA(payload, VFM_3D);
+
+            Assert::IsFalse(readVenusGpsData(&parser, &result));
+
+            FEED_FRAME(&parser, payload, sizeof(payload));
+            Assert::IsTrue(readVenusGpsData(&parser, &result));
+            Assert::IsFalse(readVenusGpsData(&parser, &result));
+        }
+
+        TEST_METHOD(Valid_3d_fix_fills_gps_data)
+        {
+            uint8_t payload[VENUS_NAVIGATION_DATA_LEN];
+            NAVIGATION_DATA(payload, VFM_3D);
+
+            FEED_FRAME(&parser, payload, sizeof(payload));
+            Assert::IsTrue(readVenusGpsData(&parser, &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::IsTrue(result.gpggaData.utcTime.isValid);
+            Assert::AreEqual((uint8_t) 12, result.gpggaData.utcTime.hours);
+            Assert::AreEqual((uint8_t) 34, result.gpggaData.utcTime.minutes);
+            Assert::AreEqual((fixedPointW2F2_t) 5600, result.gpggaData.utcTime.seconds);
+            Assert::IsTrue(result.utcDate.isValid);
+            Assert::AreEqual((uint16_t) 2024, result.utcDate.year);
+            Assert::AreEqual((uint8_t) 2, result.utcDate.month);
+            Assert::AreEqual((uint8_t) 29, result.utcDate.day);
+            Assert::AreEqual((uint8_t) 48, result.gpggaData.latitude.degrees);
+            Assert::AreEqual((fixedPointW2F6_t) 7038000, result.gpggaData.latitude.minutes);
+            Assert::AreEqual(H_NORTH, result.gpggaData.latitude.hemisphere);
+            Assert::AreEqual((uint8_t) 11, result.gpggaData.longitude.degrees);
+            Assert::AreEqual(H_EAST, result.gpggaData.longitude.hemisphere);
+            Assert::AreEqual((fixedPointW5F1_t) 5454, result.gpggaData.altitudeMslMeters);
+            Assert::AreEqual((int) GPSFT_GPS, (int) result.gpggaData.fixType);
+            Assert::AreEqual((uint8_t) 9, result.gpggaData.numberOfSattelitesInUse);
+            Assert::AreEqual((fixedPointW3F1_t) 360, result.gpvtgData.speedKph);
+            Assert::IsTrue(abs(900 - (int) result.gpvtgData.trueCourseDegrees) <= 1);
+            Assert::AreEqual((uint8_t) 3, result.gpgsaData.fixMode);
+            Assert::AreEqual((fixedPointW2F2_t) 180, result.gpgsaData.pdop);
+            Assert::AreEqual((fixedPointW2F2_t) 95, result.gpgsaData.hdop);
+            Assert::AreEqual((fixedPointW2F2_t) 152, result.gpgsaData.vdop);
+        }
+
+        TEST_METHOD(Valid_dgps_and_2d_fix_modes)
+        {
+            uint8_t payload[VENUS_NAVIGATION_DATA_LEN];
+
+            NAVIGATION_DATA(payload, VFM_3D_DGPS);
+            FEED_FRAME(&parser, payload, sizeof(payload));
+            Assert::IsTrue(readVenusGpsData(&parser, &result));
+            Assert::AreEqual((int) GPSFT_DGPS, (int) result.gpggaData.fixType);
+            Assert::AreEqual((uint8_t) 3, result.gpgsaData.fixMode);
+
+            NAVIGATION_DATA(payload, VFM_2D);
+            FEED_FRAME(&parser, payload, sizeof(payload));
+            Assert::IsTrue(readVenusGpsData(&parser, &result));
+            Assert::AreEqual((int) GPSFT_GPS, (int) result.gpggaData.fixType);
+            Assert::AreEqual((uint8_t) 2, result.gpgsaData.fixMode);
+        }
+
+        TEST_METHOD(Valid_altitude_below_sea_level_is_0)
+        {
+            uint8_t payload[VENUS_NAVIGATION_DATA_LEN];
+            NAVIGATION_DATA(payload, VFM_3D);
+            WRITE_BIG_ENDIAN(payload + VENUS_NAV_MSL_ALTITUDE, (uint32_t) -1500, 4);
+
+            FEED_FRAME(&parser, payload, sizeof(payload));
+            Assert::IsTrue(readVenusGpsData(&parser, &result));
+            Assert::AreEqual((fixedPointW5F1_t) 0, result.gpggaData.altitudeMslMeters);
+        }
+
+        TEST_METHOD(Valid_no_fix_keeps_the_last_position)
+        {
+            uint8_t payload[VENUS_NAVIGATION_DATA_LEN];
+
+            NAVIGATION_DATA(payload, VFM_3D);
+            FEED_FRAME(&parser, payload, sizeof(payload));
+            Assert::IsTrue(readVenusGpsData(&parser, &result));
+
+            NAVIGATION_DATA(payload, VFM_NO_FIX);
+            WRITE_BIG_ENDIAN(payload + VENUS_NAV_LATITUDE, 0, 4);
+            WRITE_BIG_ENDIAN(payload + VENUS_NAV_HDOP, 9999, 2);
+            FEED_FRAME(&parser, payload, sizeof(payload));
+            Assert::IsTrue(readVenusGpsData(&parser, &result));
+
+            Assert::IsTrue(result.isValid);
+            Assert::AreEqual((uint8_t) 48, result.gpggaData.latitude.degrees);
+            Assert::AreEqual((uint8_t) 1, result.gpgsaData.fixMode);
+            Assert::AreEqual((fixedPointW2F2_t) 9999, result.gpgsaData.hdop);
+        }
+
+        TEST_METHOD(Invalid_unknown_fix_mode)
+        {
+            uint8_t payload[VENUS_NAVIGATION_DATA_LEN];
+            NAVIGATION_DATA(payload, VFM_3D_DGPS + 1);
+
+            FEED_FRAME(&parser, payload, sizeof(payload));
+            Assert::IsFalse(readVenusGpsData(&parser, &result));
+            Assert::IsFalse(result.isValid);
+        }
+
+        VenusBinaryParser parser;
+        GpsData result;
+    };
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+extern "C"
+{
+    #include <venus_binary_impl.h>
+}
+
+#include "..\binary_protocol_test.h"
+
+class VenusBinaryTest : public BinaryProtocolTest<VenusBinaryParser, parseVenusBinaryByte>
+{
+    protected:
+        bool FEED_FRAME(VenusBinaryParser* pParser, const uint8_t* pPayload, uint16_t payloadLen)
+        {
+            uint8_t frame[VENUS_MAX_PAYLOAD_LEN * 2 + VENUS_FRAME_OVERHEAD_LEN];
+            return FEED(pParser, frame, createVenusFrame(pPayload, payloadLen, frame));
+        }
+
+        // 2024-02-29 12:34:56 UTC at 48.1173 N 11.5166667 E, moving east at 10 m/s
+        void NAVIGATION_DATA(uint8_t* pPayload, uint8_t fixMode)
+        {
+            memset(pPayload, 0, VENUS_NAVIGATION_DATA_LEN);
+            pPayload[0] = VENUS_NAVIGATION_DATA_ID;
+            pPayload[VENUS_NAV_FIX_MODE] = fixMode;
+            pPayload[VENUS_NAV_SATELLITES_COUNT] = 9;
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_GPS_WEEK, 2303, 2);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_TIME_OF_WEEK, 39091400, 4);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_LATITUDE, 481173000, 4);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_LONGITUDE, 115166667, 4);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_ELLIPSOID_ALTITUDE, 59235, 4);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_MSL_ALTITUDE, 54544, 4);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_PDOP, 180, 2);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_HDOP, 95, 2);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_VDOP, 152, 2);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_ECEF_VX, (uint32_t) -200, 4);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_ECEF_VY, 980, 4);
+            WRITE_BIG_ENDIAN(pPayload + VENUS_NAV_ECEF_VZ, 0, 4);
+        }
+};
@@ -1,7 +1,5 @@
 #include "aprs_board_impl.h"
 
-#include <math.h>
-#include <stdio.h>
 #include <string.h>
 
 #ifndef UNIT_TEST
@@ -14,12 +12,6 @@
 #include "timer.h"
 #include "common.h"
 
-// ran out of memory (Keil IDE limitation to 32Kb so couldn't use good tables)
-// will address this later once we move to use GCC or something like it
-#define SINE(v)            sinf(v)
-#define COSINE_G_THAN_0(v) (cosf(v) >= 0)
-#define INVERSE_SINE(v)    asinf(v)
-
 const Callsign CALLSIGN_SOURCE = 
 {
     {"HABHAB"},
@@ -47,66 +39,227 @@ const Callsign CALLSIGN_DESTINATION_2 =
            // ^^^ some reserved values and command/response
 };
 
-bool g_sendingMessage = false;
+volatile bool g_sendingMessage = false;
 
 uint16_t g_leadingOnesLeft = 0;
 uint16_t g_leadingWarmUpLeft = 0;
 BitstreamPos g_currentBitstreamPos = { 0 };
-BitstreamPos g_currentBitstreamSize = { 0 };
-uint8_t g_currentBitstream[APRS_BITSTREAM_MAX_LEN] = { 0 };
+bool g_invertBitstream = false; // owned by Pwm10Handler, keeps NRZI level continuous across queued buffers
+
+BitstreamBuffer g_bitstreamBuffers[APRS_BITSTREAM_BUFFERS_COUNT] = { 0 };
+uint8_t g_nextBitstreamBufferIdx = 0;  // owned by main loop, buffers are queued in round robin order
+uint8_t g_onAirBitstreamBufferIdx = 0; // owned by Pwm10Handler while sending
+
+// DDS_AMPLITUDE * sin(2 * pi * i / (4 * (DDS_QUARTER_WAVE_TABLE_LEN - 1))) rounded to nearest
+const uint16_t DDS_QUARTER_WAVE_SINE[DDS_QUARTER_WAVE_TABLE_LEN] =
+{
+      0,   8,  16,  24,  32,  40,  47,  55,
+     63,  71,  78,  86,  94, 101, 109, 116,
+    124, 131, 138, 145, 152, 159, 166, 173,
+    179, 186, 192, 199, 205, 211, 217, 223,
+    228, 234, 239, 245, 250, 255, 259, 264,
+    269, 273, 277, 281, 285, 289, 292, 295,
+    298, 301, 304, 307, 309, 311, 313, 315,
+    317, 318, 320, 321, 321, 322, 323, 323,
+    323,
+};
 
-bool g_currentFrequencyIsF1200 = true;
+// NRZI encoding of a byte (LSB first) when previous level is 0, invert result if previous level is 1
+static const uint8_t NRZI_ENCODED_BYTE[256] =
+{
+    0x55, 0xAA, 0xAB, 0x54, 0xA9, 0x56, 0x57, 0xA8, 0xAD, 0x52, 0x53, 0xAC, 0x51, 0xAE, 0xAF, 0x50,
+    0xA5, 0x5A, 0x5B, 0xA4, 0x59, 0xA6, 0xA7, 0x58, 0x5D, 0xA2, 0xA3, 0x5C, 0xA1, 0x5E, 0x5F, 0xA0,
+    0xB5, 0x4A, 0x4B, 0xB4, 0x49, 0xB6, 0xB7, 0x48, 0x4D, 0xB2, 0xB3, 0x4C, 0xB1, 0x4E, 0x4F, 0xB0,
+    0x45, 0xBA, 0xBB, 0x44, 0xB9, 0x46, 0x47, 0xB8, 0xBD, 0x42, 0x43, 0xBC, 0x41, 0xBE, 0xBF, 0x40,
+    0x95, 0x6A, 0x6B, 0x94, 0x69, 0x96, 0x97, 0x68, 0x6D, 0x92, 0x93, 0x6C, 0x91, 0x6E, 0x6F, 0x90,
+    0x65, 0x9A, 0x9B, 0x64, 0x99, 0x66, 0x67, 0x98, 0x9D, 0x62, 0x63, 0x9C, 0x61, 0x9E, 0x9F, 0x60,
+    0x75, 0x8A, 0x8B, 0x74, 0x89, 0x76, 0x77, 0x88, 0x8D, 0x72, 0x73, 0x8C, 0x71, 0x8E, 0x8F, 0x70,
+    0x85, 0x7A, 0x7B, 0x84, 0x79, 0x86, 0x87, 0x78, 0x7D, 0x82, 0x83, 0x7C, 0x81, 0x7E, 0x7F, 0x80,
+    0xD5, 0x2A, 0x2B, 0xD4, 0x29, 0xD6, 0xD7, 0x28, 0x2D, 0xD2, 0xD3, 0x2C, 0xD1, 0x2E, 0x2F, 0xD0,
+    0x25, 0xDA, 0xDB, 0x24, 0xD9, 0x26, 0x27, 0xD8, 0xDD, 0x22, 0x23, 0xDC, 0x21, 0xDE, 0xDF, 0x20,
+    0x35, 0xCA, 0xCB, 0x34, 0xC9, 0x36, 0x37, 0xC8, 0xCD, 0x32, 0x33, 0xCC, 0x31, 0xCE, 0xCF, 0x30,
+    0xC5, 0x3A, 0x3B, 0xC4, 0x39, 0xC6, 0xC7, 0x38, 0x3D, 0xC2, 0xC3, 0x3C, 0xC1, 0x3E, 0x3F, 0xC0,
+    0x15, 0xEA, 0xEB, 0x14, 0xE9, 0x16, 0x17, 0xE8, 0xED, 0x12, 0x13, 0xEC, 0x11, 0xEE, 0xEF, 0x10,
+    0xE5, 0x1A, 0x1B, 0xE4, 0x19, 0xE6, 0xE7, 0x18, 0x1D, 0xE2, 0xE3, 0x1C, 0xE1, 0x1E, 0x1F, 0xE0,
+    0xF5, 0x0A, 0x0B, 0xF4, 0x09, 0xF6, 0xF7, 0x08, 0x0D, 0xF2, 0xF3, 0x0C, 0xF1, 0x0E, 0x0F, 0xF0,
+    0x05, 0xFA, 0xFB, 0x04, 0xF9, 0x06, 0x07, 0xF8, 0xFD, 0x02, 0x03, 0xFC, 0x01, 0xFE, 0xFF, 0x00,
+};
 
-float g_currentF1200Frame = 0;
-float g_currentF2200Frame = 0;
+// see STUFFING_LEADING_ONES/STUFFING_TRAILING_ONES
+static const uint8_t STUFFING_ONES_RUNS[256] =
+{
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x0F,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x0F, 0x0F,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x0F,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x14,
+    0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x1F,
+    0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x14,
+    0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x1F, 0x1F,
+    0x20, 0x21, 0x20, 0x22, 0x20, 0x21, 0x20, 0x23, 0x20, 0x21, 0x20, 0x22, 0x20, 0x21, 0x20, 0x24,
+    0x20, 0x21, 0x20, 0x22, 0x20, 0x21, 0x20, 0x23, 0x20, 0x21, 0x20, 0x22, 0x20, 0x21, 0x20, 0x2F,
+    0x30, 0x31, 0x30, 0x32, 0x30, 0x31, 0x30, 0x33, 0x30, 0x31, 0x30, 0x32, 0x30, 0x31, 0x30, 0x34,
+    0x40, 0x41, 0x40, 0x42, 0x40, 0x41, 0x40, 0x43, 0x5F, 0x5F, 0x5F, 0x5F, 0x6F, 0x6F, 0x7F, 0x8F,
+};
+
+uint32_t g_ddsPhase = 0;
+uint32_t g_ddsPhaseIncrement = DDS_PHASE_INCREMENT_F1200;
 uint8_t g_currentSymbolPulsesCount = 0;
 
 uint16_t g_aprsMessageId = 0;
-uint8_t g_aprsPayloadBuffer[APRS_PAYLOAD_LEN];
+uint8_t g_aprsFrameBuffer[APRS_FRAME_MAX_LEN];
+
+FrameHeaderCache g_frameHeaderCache;
+
+#ifdef APRS_FX25
+uint8_t g_fx25Codeblock[FX25_CODEBLOCK_BUFFER_LEN];
+#endif
+
+#ifdef APRS_COMPRESSED_POSITION
+APRS_PAYLOAD_FORMAT g_aprsPayloadFormat = APF_COMPRESSED_ALTITUDE;
+#else
+APRS_PAYLOAD_FORMAT g_aprsPayloadFormat = APF_UNCOMPRESSED;
+#endif
+
+// 1.002^(2^i), compressed altitude in feet is 1.002^cs
+const float COMPRESSED_ALTITUDE_POWERS[COMPRESSED_ALTITUDE_POWERS_COUNT] =
+{
+    1.002f, 1.004004f, 1.00802403f, 1.01611245f, 1.03248451f, 1.06602426f, 1.13640773f,
+    1.29142252f, 1.66777213f, 2.78146388f, 7.73654129f, 59.8540712f, 3582.50984f, 12834376.8f,
+};
+
+// 1.08^(2^i), compressed speed in knots is 1.08^s - 1
+const float COMPRESSED_SPEED_POWERS[COMPRESSED_SPEED_POWERS_COUNT] =
+{
+    1.08f, 1.1664f, 1.36048896f, 1.85093021f, 3.42594264f, 11.737083f, 137.759117f,
+};
 
 void initializeAprs(void)
 {
     initializeAprsHardware(PWM_PERIOD, PWM_MIN_PULSE_WIDTH);
+    initializeFrameHeaderCache(&CALLSIGN_SOURCE, &g_frameHeaderCache);
+#ifdef APRS_FX25
+    initializeFx25();
+#endif
 }
 
-bool sendAprsMessage(GpsDataSource gpsDataSource, const GpsData* pGpsData, const Telemetry* pTelemetry)
+void setAprsPayloadFormat(APRS_PAYLOAD_FORMAT payloadFormat)
 {
-    if (g_sendingMessage)
+    g_aprsPayloadFormat = payloadFormat;
+}
+
+bool prepareAprsMessage(const AprsMessage* pMessages, uint8_t messagesCount, const Telemetry* pTelemetry)
+{
+    BitstreamBuffer* const pBuffer = &g_bitstreamBuffers[g_nextBitstreamBufferIdx];
+
+    // buffer might still be queued or on air
+    if (pBuffer->state != BBS_FREE && pBuffer->state != BBS_PREPARED)
     {
         return false;
     }
 
-    g_leadingOnesLeft = LEADING_ONES_COUNT_TO_CANCEL_PREVIOUS_PACKET;
-    g_leadingWarmUpLeft = LEADING_WARMUP_AMPLITUDE_DC_PULSES_COUNT;
-    
-    g_currentBitstreamSize.bitstreamCharIdx = 0;
-    g_currentBitstreamSize.bitstreamCharBitIdx = 0;
+    pBuffer->state = BBS_FREE;
 
-    g_currentBitstreamPos.bitstreamCharIdx = 0;
-    g_currentBitstreamPos.bitstreamCharBitIdx = 0;
+    if (!generateMessage(&g_frameHeaderCache,
+                         pMessages,
+                         messagesCount,
+                         pTelemetry,
+                         pBuffer->bitstream,
+                         APRS_BITSTREAM_MAX_LEN,
+                         &pBuffer->size,
+                         &pBuffer->lastBit))
+    {
+        return false;
+    }
+
+    pBuffer->state = BBS_PREPARED;
 
-    g_currentF1200Frame = 0;
-    g_currentF2200Frame = 0;
-    g_currentFrequencyIsF1200 = true;
-    g_currentSymbolPulsesCount = F1200_PWM_PULSES_COUNT_PER_SYMBOL;
+    return true;
+}
+
+bool transmitAprsMessage(void)
+{
+    const uint8_t bufferIdx = g_nextBitstreamBufferIdx;
+    BitstreamBuffer* const pBuffer = &g_bitstreamBuffers[bufferIdx];
 
-    if (generateMessage(&CALLSIGN_SOURCE,
-                        gpsDataSource,
-                        pGpsData,
-                        pTelemetry,
-                        g_currentBitstream,
-                        APRS_BITSTREAM_MAX_LEN,
-                        &g_currentBitstreamSize))
+    if (pBuffer->state != BBS_PREPARED)
     {
+        return false;
+    }
+
+    g_nextBitstreamBufferIdx = (bufferIdx + 1) % APRS_BITSTREAM_BUFFERS_COUNT;
+
+    // Pwm10Handler must not finish sending between the check and the handoff,
+    // otherwise queued buffer would never be sent
+
+    const bool wereInterruptsDisabled = disableInterrupts();
+
+    pBuffer->state = BBS_QUEUED;
+
+    const bool shouldKeyUp = !g_sendingMessage;
+    if (shouldKeyUp)
+    {
+        pBuffer->state = BBS_ON_AIR;
+        g_onAirBitstreamBufferIdx = bufferIdx;
+
+        g_leadingOnesLeft = LEADING_ONES_COUNT_TO_CANCEL_PREVIOUS_PACKET;
+        g_leadingWarmUpLeft = LEADING_WARMUP_AMPLITUDE_DC_PULSES_COUNT;
+
+        g_currentBitstreamPos.bitstreamCharIdx = 0;
+        g_currentBitstreamPos.bitstreamCharBitIdx = 0;
+        g_invertBitstream = false;
+
+        g_ddsPhase = 0;
+        g_ddsPhaseIncrement = DDS_PHASE_INCREMENT_F1200;
+        g_currentSymbolPulsesCount = F1200_PWM_PULSES_COUNT_PER_SYMBOL;
+
         g_sendingMessage = true;
+    }
+
+    restoreInterrupts(wereInterruptsDisabled);
+
+    if (shouldKeyUp)
+    {
         enableHx1();
         enableAprsPwm();
-        return true;
     }
-    else
+
+    return true;
+}
+
+bool sendAprsMessage(const AprsMessage* pMessages, uint8_t messagesCount, const Telemetry* pTelemetry)
+{
+    return prepareAprsMessage(pMessages, messagesCount, pTelemetry) && transmitAprsMessage();
+}
+
+bool switchToNextBitstreamBuffer(void)
+{
+    BitstreamBuffer* const pSentBuffer = &g_bitstreamBuffers[g_onAirBitstreamBufferIdx];
+    const bool isSentBufferLastLevelOne = (pSentBuffer->lastBit != 0) != g_invertBitstream;
+
+    pSentBuffer->state = BBS_FREE;
+    g_onAirBitstreamBufferIdx = (g_onAirBitstreamBufferIdx + 1) % APRS_BITSTREAM_BUFFERS_COUNT;
+
+    BitstreamBuffer* const pNextBuffer = &g_bitstreamBuffers[g_onAirBitstreamBufferIdx];
+    if (pNextBuffer->state != BBS_QUEUED)
     {
         return false;
     }
+
+    pNextBuffer->state = BBS_ON_AIR;
+
+    g_currentBitstreamPos.bitstreamCharIdx = 0;
+    g_currentBitstreamPos.bitstreamCharBitIdx = 0;
+
+    // every buffer is encoded starting from level one, inverted NRZI bitstream carries the same data
+    // so queued buffer is inverted when sent one ended at level zero, otherwise its opening flag is lost
+    g_invertBitstream = !isSentBufferLastLevelOne;
+
+    return true;
 }
 
 void advanceBitstreamBit(BitstreamPos* pResultBitstreamSize)
@@ -128,7 +281,6 @@ bool encodeAndAppendBits(uint8_t* pBitstreamBuffer,
                          const uint8_t* pMessageData,
                          uint16_t messageDataSize,
                          STUFFING_TYPE stuffingType,
-                         FCS_TYPE fcsType,
                          SHIFT_ONE_LEFT_TYPE shiftOneLeftType)
 {
     if (!pBitstreamBuffer || !pEncodingData || maxBitstreamBufferLen < messageDataSize)
@@ -144,6 +296,20 @@ bool encodeAndAppendBits(uint8_t* pBitstreamBuffer,
         return false;
     }
 
+    uint16_t charIdx = pEncodingData->bitstreamSize.bitstreamCharIdx;
+    uint8_t lastBit = pEncodingData->lastBit ? 1 : 0;
+    uint8_t numberOfOnes = pEncodingData->numberOfOnes;
+
+    if (charIdx >= maxBitstreamBufferLen)
+    {
+        return false;
+    }
+
+    // bits are collected in accumulator (LSB first) and written to bitstream once full byte is ready,
+    // bits which were already encoded into current byte are kept
+    uint32_t accumulator = pBitstreamBuffer[charIdx] & ((1 << pEncodingData->bitstreamSize.bitstreamCharBitIdx) - 1);
+    uint8_t accumulatorBits = pEncodingData->bitstreamSize.bitstreamCharBitIdx;
+
     for (uint16_t iByte = 0; iByte < messageDataSize; ++iByte)
     {
         uint8_t currentByte = pMessageData[iByte];
@@ -153,271 +319,804 @@ bool encodeAndAppendBits(uint8_t* pBitstreamBuffer,
             currentByte <<= 1;
         }
 
-        for (uint8_t iBit = 0; iBit < 8; ++iBit)
-        {
-            const uint8_t currentBit = currentByte & (1 << iBit);
+        const uint8_t onesRuns = STUFFING_ONES_RUNS[currentByte];
 
-            // add FCS calculation based on tables
-            // to improve speed (need to migrate to GCC due to 
-            // 32Kb application size limit in Keil)
+        if (stuffingType == ST_NO_STUFFING || numberOfOnes + STUFFING_LEADING_ONES(onesRuns) < STUFFING_MAX_ONES)
+        {
+            // fast path, no stuffing is needed inside of this byte so whole byte is encoded at once
+            const uint8_t encodedByte = NRZI_ENCODED_BYTE[currentByte] ^ (lastBit ? 0xFF : 0x00);
 
-            if (fcsType == FCS_CALCULATE)
+            accumulator |= (uint32_t) encodedByte << accumulatorBits;
+            accumulatorBits += 8;
+            lastBit = encodedByte >> 7;
+            numberOfOnes = STUFFING_TRAILING_ONES(onesRuns);
+        }
+        else
+        {
+            for (uint8_t iBit = 0; iBit < 8; ++iBit)
             {
-                const uint16_t shiftBit = pEncodingData->fcs & 0x0001;
-                pEncodingData->fcs = pEncodingData->fcs >> 1;
-                if (shiftBit != ((currentByte >> iBit) & 0x01))
+                if (currentByte & (1 << iBit))
                 {
-                    pEncodingData->fcs ^= FCS_POLYNOMIAL;
-                }
-            }
+                    // as we are encoding 1 keep current bit as is
+                    accumulator |= (uint32_t) lastBit << accumulatorBits++;
 
-            if (currentBit)
-            {
-                if (pEncodingData->bitstreamSize.bitstreamCharIdx >= maxBitstreamBufferLen)
-                {
-                    return false;
-                }
-                // as we are encoding 1 keep current bit as is
-                if (pEncodingData->lastBit)
-                {
-                    pBitstreamBuffer[pEncodingData->bitstreamSize.bitstreamCharIdx] |= 1 << (pEncodingData->bitstreamSize.bitstreamCharBitIdx);
-                }
-                else
-                {
-                    pBitstreamBuffer[pEncodingData->bitstreamSize.bitstreamCharIdx] &= ~(1 << (pEncodingData->bitstreamSize.bitstreamCharBitIdx));
-                }
-
-                advanceBitstreamBit(&pEncodingData->bitstreamSize);
-
-                if (stuffingType == ST_PERFORM_STUFFING)
-                {
-                    ++pEncodingData->numberOfOnes;
-                    
-                    if (pEncodingData->numberOfOnes == 5)
+                    if (++numberOfOnes == STUFFING_MAX_ONES)
                     {
-                        if (pEncodingData->bitstreamSize.bitstreamCharIdx >= maxBitstreamBufferLen)
-                        {
-                            return false;
-                        }
-
                         // we need to insert 0 after 5 consecutive ones
-                        if (pEncodingData->lastBit)
-                        {
-                            pBitstreamBuffer[pEncodingData->bitstreamSize.bitstreamCharIdx] &= ~(1 << (pEncodingData->bitstreamSize.bitstreamCharBitIdx));
-                            pEncodingData->lastBit = 0;
-                        }
-                        else
-                        {
-                            pBitstreamBuffer[pEncodingData->bitstreamSize.bitstreamCharIdx] |= 1 << (pEncodingData->bitstreamSize.bitstreamCharBitIdx);
-                            pEncodingData->lastBit = 1;
-                        }
-                        
-                        pEncodingData->numberOfOnes = 0;
-                        
-                        advanceBitstreamBit(&pEncodingData->bitstreamSize); // insert zero as we had 5 ones
+                        lastBit ^= 1;
+                        accumulator |= (uint32_t) lastBit << accumulatorBits++;
+                        numberOfOnes = 0;
                     }
                 }
-            }
-            else
-            {
-                if (pEncodingData->bitstreamSize.bitstreamCharIdx >= maxBitstreamBufferLen)
-                {
-                    return false;
-                }
-                
-                // as we are encoding 0 we need to flip bit
-                if (pEncodingData->lastBit)
-                {
-                    pBitstreamBuffer[pEncodingData->bitstreamSize.bitstreamCharIdx] &= ~(1 << (pEncodingData->bitstreamSize.bitstreamCharBitIdx));
-                    pEncodingData->lastBit = 0;
-                }
                 else
                 {
-                    pBitstreamBuffer[pEncodingData->bitstreamSize.bitstreamCharIdx] |= 1 << (pEncodingData->bitstreamSize.bitstreamCharBitIdx);
-                    pEncodingData->lastBit = 1;
+                    // as we are encoding 0 we need to flip bit
+                    lastBit ^= 1;
+                    accumulator |= (uint32_t) lastBit << accumulatorBits++;
+                    numberOfOnes = 0;
                 }
+            }
+        }
 
-                advanceBitstreamBit(&pEncodingData->bitstreamSize);
-
-                if (stuffingType == ST_PERFORM_STUFFING)
-                {
-                    pEncodingData->numberOfOnes = 0;
-                }
+        while (accumulatorBits >= 8)
+        {
+            if (charIdx >= maxBitstreamBufferLen)
+            {
+                return false;
             }
+            pBitstreamBuffer[charIdx++] = (uint8_t) accumulator;
+            accumulator >>= 8;
+            accumulatorBits -= 8;
         }
     }
 
-    if (stuffingType == ST_NO_STUFFING)
+    if (accumulatorBits)
     {
-        // resert ones as we didn't do any stuffing while sending this data
-        pEncodingData->numberOfOnes = 0;
+        if (charIdx >= maxBitstreamBufferLen)
+        {
+            return false;
+        }
+        pBitstreamBuffer[charIdx] = (uint8_t) accumulator;
     }
 
+    pEncodingData->bitstreamSize.bitstreamCharIdx = charIdx;
+    pEncodingData->bitstreamSize.bitstreamCharBitIdx = accumulatorBits;
+    pEncodingData->lastBit = lastBit;
+
+    // resert ones if we didn't do any stuffing while sending this data
+    pEncodingData->numberOfOnes = stuffingType == ST_NO_STUFFING ? 0 : numberOfOnes;
+
     return true;
 }
 
+uint8_t formatDecimal(uint32_t value, uint8_t width, uint8_t* pBuffer)
+{
+    // least significant digit goes last
+
+    for (uint8_t i = width; i > 0; --i)
+    {
+        pBuffer[i - 1] = '0' + value % 10;
+        value /= 10;
+    }
+
+    return width;
+}
+
+uint8_t formatTimestamp(const GpsTime* pTime, uint8_t* pBuffer)
+{
+    uint8_t bufferIdx = 0;
+
+    pBuffer[bufferIdx++] = '@';
+    bufferIdx += formatDecimal(pTime->hours, 2, &pBuffer[bufferIdx]);
+    bufferIdx += formatDecimal(pTime->minutes, 2, &pBuffer[bufferIdx]);
+    bufferIdx += formatDecimal(pTime->seconds / 100, 2, &pBuffer[bufferIdx]);
+    pBuffer[bufferIdx++] = 'z';
+
+    return bufferIdx;
+}
+
+uint8_t formatAngularCoordinate(const AngularCoordinate* pCoordinate, uint8_t degreesWidth, uint8_t* pBuffer)
+{
+    const uint32_t minutesWhole = pCoordinate->minutes / 1000000;
+    const uint32_t minutesFraction = (pCoordinate->minutes - minutesWhole * 1000000) / 10000;
+
+    uint8_t bufferIdx = 0;
+
+    bufferIdx += formatDecimal(pCoordinate->degrees, degreesWidth, &pBuffer[bufferIdx]);
+    bufferIdx += formatDecimal(minutesWhole, 2, &pBuffer[bufferIdx]);
+    pBuffer[bufferIdx++] = '.';
+    bufferIdx += formatDecimal(minutesFraction, 2, &pBuffer[bufferIdx]);
+    pBuffer[bufferIdx++] = pCoordinate->hemisphere;
+
+    return bufferIdx;
+}
+
 uint8_t createPacketPayload(GpsDataSource gpsDataSource, const GpsData* pGpsData, const Telemetry* pTelemetry, uint16_t messageIdx, uint8_t* pBuffer, uint8_t bufferSize)
 {
     uint8_t bufferStartIdx = 0;
-    
+
     if (pGpsData->gpggaData.latitude.isValid && pGpsData->gpggaData.longitude.isValid)
     {
-        if (pGpsData->gpggaData.utcTime.isValid)
+        // @hhmmssz or !, DDMM.hhN/DDDMM.hhW>CCC/SSS
+
+        const uint8_t positionLen = (pGpsData->gpggaData.utcTime.isValid ? APRS_TIMESTAMP_LEN : 1) + APRS_POSITION_LEN + APRS_COURSE_SPEED_LEN;
+        if (bufferStartIdx + positionLen > bufferSize)
         {
-            if (bufferStartIdx + 8 > bufferSize)
-            {
-                return 0;
-            }
+            return 0;
+        }
 
-            bufferStartIdx += sprintf((char*) &pBuffer[bufferStartIdx],
-                                      "@%02u%02u%02uz",
-                                      pGpsData->gpggaData.utcTime.hours,
-                                      pGpsData->gpggaData.utcTime.minutes,
-                                      pGpsData->gpggaData.utcTime.seconds / 100);
+        if (pGpsData->gpggaData.utcTime.isValid)
+        {
+            bufferStartIdx += formatTimestamp(&pGpsData->gpggaData.utcTime, &pBuffer[bufferStartIdx]);
         }
         else
         {
-            if (bufferStartIdx + 1 > bufferSize)
-            {
-                return 0;
-            }
-
             pBuffer[bufferStartIdx++] = '!';
         }
 
-        if (bufferStartIdx + 19 > bufferSize)
+        bufferStartIdx += formatAngularCoordinate(&pGpsData->gpggaData.latitude, 2, &pBuffer[bufferStartIdx]);
+        pBuffer[bufferStartIdx++] = '/';
+        bufferStartIdx += formatAngularCoordinate(&pGpsData->gpggaData.longitude, 3, &pBuffer[bufferStartIdx]);
+
+        pBuffer[bufferStartIdx++] = '>';
+        bufferStartIdx += formatDecimal(pGpsData->gpvtgData.trueCourseDegrees / 10, 3, &pBuffer[bufferStartIdx]);
+        pBuffer[bufferStartIdx++] = '/';
+        bufferStartIdx += formatDecimal(pGpsData->gpvtgData.speedKph / 10, 3, &pBuffer[bufferStartIdx]);
+    }
+
+    // T#sss,111,222,333,444,555,00000000 a=AAAAA
+
+    if (bufferStartIdx + APRS_TELEMETRY_LEN > bufferSize)
+    {
+        return 0;
+    }
+
+    pBuffer[bufferStartIdx++] = 'T';
+    pBuffer[bufferStartIdx++] = '#';
+    bufferStartIdx += formatDecimal(messageIdx, 3, &pBuffer[bufferStartIdx]);
+    pBuffer[bufferStartIdx++] = ',';
+    bufferStartIdx += formatDecimal(gpsDataSource, 3, &pBuffer[bufferStartIdx]);
+    pBuffer[bufferStartIdx++] = ',';
+    bufferStartIdx += formatDecimal(pTelemetry->cpuTemperature / 10, 3, &pBuffer[bufferStartIdx]);
+    pBuffer[bufferStartIdx++] = ',';
+    bufferStartIdx += formatDecimal(pTelemetry->voltage / 10, 3, &pBuffer[bufferStartIdx]);
+    memcpy(&pBuffer[bufferStartIdx], APRS_TELEMETRY_UNUSED_FIELDS, sizeof(APRS_TELEMETRY_UNUSED_FIELDS) - 1);
+    bufferStartIdx += sizeof(APRS_TELEMETRY_UNUSED_FIELDS) - 1;
+    bufferStartIdx += formatDecimal(pGpsData->gpggaData.altitudeMslMeters / 10, 5, &pBuffer[bufferStartIdx]);
+
+    return bufferStartIdx;
+}
+
+void encodeBase91(uint32_t value, uint8_t* pBuffer, uint8_t digitsCount)
+{
+    // most significant digit goes first
+
+    for (uint8_t i = digitsCount; i > 0; --i)
+    {
+        pBuffer[i - 1] = BASE91_FIRST_CHAR + value % 91;
+        value /= 91;
+    }
+}
+
+uint32_t compressedLatitude(const AngularCoordinate* pLatitude)
+{
+    int64_t microMinutes = (int64_t) pLatitude->degrees * COMPRESSED_MICRO_MINUTES_PER_DEGREE + pLatitude->minutes;
+    if (pLatitude->hemisphere == H_SOUTH)
+    {
+        microMinutes = -microMinutes;
+    }
+
+    return (uint32_t) ((int64_t) COMPRESSED_LATITUDE_SCALE * (90LL * COMPRESSED_MICRO_MINUTES_PER_DEGREE - microMinutes) / COMPRESSED_MICRO_MINUTES_PER_DEGREE);
+}
+
+uint32_t compressedLongitude(const AngularCoordinate* pLongitude)
+{
+    int64_t microMinutes = (int64_t) pLongitude->degrees * COMPRESSED_MICRO_MINUTES_PER_DEGREE + pLongitude->minutes;
+    if (pLongitude->hemisphere == H_WEST)
+    {
+        microMinutes = -microMinutes;
+    }
+
+    return (uint32_t) ((int64_t) COMPRESSED_LONGITUDE_SCALE * (180LL * COMPRESSED_MICRO_MINUTES_PER_DEGREE + microMinutes) / COMPRESSED_MICRO_MINUTES_PER_DEGREE);
+}
+
+uint16_t compressedLogarithm(float value, const float* pPowers, uint8_t powersCount, uint16_t maxResult)
+{
+    if (value <= 1.0f)
+    {
+        return 0;
+    }
+
+    // builds the largest n for which base^n <= value bit by bit, so there is no need for logf
+
+    uint16_t result = 0;
+    float power = 1.0f;
+
+    for (uint8_t i = powersCount; i > 0; --i)
+    {
+        const float nextPower = power * pPowers[i - 1];
+        if (nextPower <= value)
         {
-            return 0;
+            power = nextPower;
+            result += 1 << (i - 1);
         }
+    }
+
+    if (value - power > power * pPowers[0] - value)
+    {
+        ++result;
+    }
 
-        const uint32_t latMinutesWhole = pGpsData->gpggaData.latitude.minutes / 1000000;
-        const uint32_t latMinutesFraction = (pGpsData->gpggaData.latitude.minutes - latMinutesWhole * 1000000) / 10000;
+    return result > maxResult ? maxResult : result;
+}
+
+uint8_t createCompressedPacketPayload(APRS_PAYLOAD_FORMAT payloadFormat,
+                                      GpsDataSource gpsDataSource,
+                                      const GpsData* pGpsData,
+                                      const Telemetry* pTelemetry,
+                                      uint16_t messageIdx,
+                                      uint8_t* pBuffer,
+                                      uint8_t bufferSize)
+{
+    // compressed telemetry extension goes to position comment so there is nothing to compress without position
 
-        const uint32_t lonMinutesWhole = pGpsData->gpggaData.longitude.minutes / 1000000;
-        const uint32_t lonMinutesFraction = (pGpsData->gpggaData.longitude.minutes - lonMinutesWhole * 1000000) / 10000;
+    if (!pGpsData->gpggaData.latitude.isValid || !pGpsData->gpggaData.longitude.isValid)
+    {
+        return createPacketPayload(gpsDataSource, pGpsData, pTelemetry, messageIdx, pBuffer, bufferSize);
+    }
 
-        bufferStartIdx += sprintf((char*) &pBuffer[bufferStartIdx],
-                                  "%02u%02u.%02u%1c/%03u%02u.%02u%1c",
-                                  pGpsData->gpggaData.latitude.degrees,
-                                  latMinutesWhole,
-                                  latMinutesFraction,
-                                  pGpsData->gpggaData.latitude.hemisphere,
-                                  pGpsData->gpggaData.longitude.degrees,
-                                  lonMinutesWhole,
-                                  lonMinutesFraction,
-                                  pGpsData->gpggaData.longitude.hemisphere);
+    uint8_t bufferStartIdx = 0;
 
-        if (bufferStartIdx + 7 > bufferSize)
+    if (pGpsData->gpggaData.utcTime.isValid)
+    {
+        if (bufferStartIdx + APRS_TIMESTAMP_LEN > bufferSize)
         {
             return 0;
         }
 
-        bufferStartIdx += sprintf((char*) &pBuffer[bufferStartIdx],
-                                  ">%03u/%03u",
-                                  (uint32_t) (pGpsData->gpvtgData.trueCourseDegrees / 10),
-                                  (uint32_t) (pGpsData->gpvtgData.speedKph / 10));
+        bufferStartIdx += formatTimestamp(&pGpsData->gpggaData.utcTime, &pBuffer[bufferStartIdx]);
     }
+    else
+    {
+        if (bufferStartIdx + 1 > bufferSize)
+        {
+            return 0;
+        }
+
+        pBuffer[bufferStartIdx++] = '!';
+    }
+
+    // /YYYYXXXX>csT
 
-    if (bufferStartIdx + 42 > bufferSize)
+    if (bufferStartIdx + 13 > bufferSize)
     {
         return 0;
     }
 
-    bufferStartIdx += sprintf((char*) &pBuffer[bufferStartIdx],
-                              "T#%03u,%03u,%03u,%03u,000,000,00000000 a=%05u",
-                              messageIdx, 
-                              gpsDataSource,
-                              pTelemetry->cpuTemperature / 10,
-                              pTelemetry->voltage / 10,
-                              (uint32_t) pGpsData->gpggaData.altitudeMslMeters / 10);
+    pBuffer[bufferStartIdx++] = '/';
+    encodeBase91(compressedLatitude(&pGpsData->gpggaData.latitude), &pBuffer[bufferStartIdx], 4);
+    bufferStartIdx += 4;
+    encodeBase91(compressedLongitude(&pGpsData->gpggaData.longitude), &pBuffer[bufferStartIdx], 4);
+    bufferStartIdx += 4;
+    pBuffer[bufferStartIdx++] = '>';
+
+    if (payloadFormat == APF_COMPRESSED_ALTITUDE)
+    {
+        const float altitudeFeet = (float) pGpsData->gpggaData.altitudeMslMeters * 0.328084f;
+        encodeBase91(compressedLogarithm(altitudeFeet, COMPRESSED_ALTITUDE_POWERS, COMPRESSED_ALTITUDE_POWERS_COUNT, BASE91_MAX_2_CHARS_VALUE), &pBuffer[bufferStartIdx], 2);
+        bufferStartIdx += 2;
+        pBuffer[bufferStartIdx++] = BASE91_FIRST_CHAR + COMPRESSED_TYPE_ALTITUDE;
+    }
+    else
+    {
+        const float speedKnots = (float) pGpsData->gpvtgData.speedKph / 18.52f;
+        pBuffer[bufferStartIdx++] = BASE91_FIRST_CHAR + (pGpsData->gpvtgData.trueCourseDegrees / 10) % 360 / 4;
+        pBuffer[bufferStartIdx++] = BASE91_FIRST_CHAR + compressedLogarithm(speedKnots + 1.0f, COMPRESSED_SPEED_POWERS, COMPRESSED_SPEED_POWERS_COUNT, COMPRESSED_MAX_COURSE_SPEED_VALUE);
+        pBuffer[bufferStartIdx++] = BASE91_FIRST_CHAR + COMPRESSED_TYPE_COURSE_SPEED;
+    }
+
+    const uint8_t telemetrySize = createCompressedTelemetry(gpsDataSource, pGpsData, pTelemetry, messageIdx, &pBuffer[bufferStartIdx], bufferSize - bufferStartIdx);
+    if (telemetrySize == 0)
+    {
+        return 0;
+    }
+
+    return bufferStartIdx + telemetrySize;
+}
+
+uint8_t createCompressedTelemetry(GpsDataSource gpsDataSource,
+                                  const GpsData* pGpsData,
+                                  const Telemetry* pTelemetry,
+                                  uint16_t messageIdx,
+                                  uint8_t* pBuffer,
+                                  uint8_t bufferSize)
+{
+    // |ss11223344| sequence, gps data source, temperature, voltage and altitude in tens of meters
+
+    if (bufferSize < COMPRESSED_TELEMETRY_LEN)
+    {
+        return 0;
+    }
+
+    const uint32_t telemetryValues[5] =
+    {
+        messageIdx,
+        gpsDataSource,
+        pTelemetry->cpuTemperature / 10,
+        pTelemetry->voltage / 10,
+        pGpsData->gpggaData.altitudeMslMeters / 100,
+    };
+
+    uint8_t bufferStartIdx = 0;
+
+    pBuffer[bufferStartIdx++] = '|';
+    for (uint8_t i = 0; i < 5; ++i)
+    {
+        const uint32_t value = i == 0 ? telemetryValues[i] % (BASE91_MAX_2_CHARS_VALUE + 1) :
+                                        (telemetryValues[i] > BASE91_MAX_2_CHARS_VALUE ? BASE91_MAX_2_CHARS_VALUE : telemetryValues[i]);
+        encodeBase91(value, &pBuffer[bufferStartIdx], 2);
+        bufferStartIdx += 2;
+    }
+    pBuffer[bufferStartIdx++] = '|';
 
     return bufferStartIdx;
 }
 
-bool generateMessage(const Callsign* pCallsignSource,
-                     GpsDataSource gpsDataSource,
-                     const GpsData* pGpsData,
-                     const Telemetry* pTelemetry,
+void createMicEDestination(const AngularCoordinate* pLatitude, const AngularCoordinate* pLongitude, uint8_t* pDestination)
+{
+    const uint32_t minutesWhole = pLatitude->minutes / 1000000;
+    const uint32_t minutesFraction = (pLatitude->minutes - minutesWhole * 1000000) / 10000;
+
+    const uint8_t digits[6] =
+    {
+        pLatitude->degrees / 10, pLatitude->degrees % 10,
+        minutesWhole / 10, minutesWhole % 10,
+        minutesFraction / 10, minutesFraction % 10,
+    };
+
+    // every digit is either 0-9 for bit 0 or P-Y for bit 1,
+    // bits are message A B C, north, longitude offset of 100 degrees and west
+
+    const bool bits[6] =
+    {
+        (MIC_E_MESSAGE_BITS & 0x04) != 0,
+        (MIC_E_MESSAGE_BITS & 0x02) != 0,
+        (MIC_E_MESSAGE_BITS & 0x01) != 0,
+        pLatitude->hemisphere == H_NORTH,
+        pLongitude->degrees < 10 || pLongitude->degrees >= 100,
+        pLongitude->hemisphere == H_WEST,
+    };
+
+    for (uint8_t i = 0; i < 6; ++i)
+    {
+        pDestination[i] = (bits[i] ? 'P' : '0') + digits[i];
+    }
+}
+
+uint8_t createMicEPacketPayload(GpsDataSource gpsDataSource,
+                                const GpsData* pGpsData,
+                                const Telemetry* pTelemetry,
+                                uint16_t messageIdx,
+                                uint8_t* pHeader,
+                                uint8_t* pBuffer,
+                                uint8_t bufferSize)
+{
+    // latitude has to go to destination address so there is nothing to encode without position
+
+    if (!pGpsData->gpggaData.latitude.isValid || !pGpsData->gpggaData.longitude.isValid)
+    {
+        return createPacketPayload(gpsDataSource, pGpsData, pTelemetry, messageIdx, pBuffer, bufferSize);
+    }
+
+    if (!pHeader || bufferSize < MIC_E_LEN)
+    {
+        return 0;
+    }
+
+    uint8_t destination[AX25_ADDRESS_LEN - 1];
+    createMicEDestination(&pGpsData->gpggaData.latitude, &pGpsData->gpggaData.longitude, destination);
+
+    for (uint8_t i = 0; i < AX25_ADDRESS_LEN - 1; ++i)
+    {
+        pHeader[i] = destination[i] << 1;
+    }
+    pHeader[AX25_ADDRESS_LEN - 1] = MIC_E_DESTINATION_SSID;
+
+    // longitude degrees are stored with offset given by destination address
+
+    const uint8_t lonDegrees = pGpsData->gpggaData.longitude.degrees;
+    const uint32_t lonMinutesWhole = pGpsData->gpggaData.longitude.minutes / 1000000;
+    const uint32_t lonMinutesFraction = (pGpsData->gpggaData.longitude.minutes - lonMinutesWhole * 1000000) / 10000;
+
+    uint8_t d;
+    if (lonDegrees < 10)
+    {
+        d = lonDegrees + 90;
+    }
+    else if (lonDegrees < 100)
+    {
+        d = lonDegrees;
+    }
+    else if (lonDegrees < 110)
+    {
+        d = lonDegrees - 20;
+    }
+    else
+    {
+        d = lonDegrees - 100;
+    }
+
+    // speed is in knots, course in degrees, both are split across 3 bytes, speed above what fits is reported as max
+
+    const uint32_t speedKnots = (pGpsData->gpvtgData.speedKph * 100 + 926) / 1852;
+    const uint32_t clampedSpeedKnots = speedKnots > 799 ? 799 : speedKnots;
+    const uint32_t courseDegrees = pGpsData->gpvtgData.trueCourseDegrees / 10 % 360;
+
+    uint8_t bufferStartIdx = 0;
+
+    pBuffer[bufferStartIdx++] = MIC_E_CURRENT_GPS_DATA;
+    pBuffer[bufferStartIdx++] = MIC_E_CHAR_OFFSET + d;
+    pBuffer[bufferStartIdx++] = MIC_E_CHAR_OFFSET + (lonMinutesWhole < 10 ? lonMinutesWhole + 60 : lonMinutesWhole);
+    pBuffer[bufferStartIdx++] = MIC_E_CHAR_OFFSET + lonMinutesFraction;
+    pBuffer[bufferStartIdx++] = MIC_E_CHAR_OFFSET + clampedSpeedKnots / 10;
+    pBuffer[bufferStartIdx++] = MIC_E_CHAR_OFFSET + clampedSpeedKnots % 10 * 10 + courseDegrees / 100;
+    pBuffer[bufferStartIdx++] = MIC_E_CHAR_OFFSET + courseDegrees % 100;
+    pBuffer[bufferStartIdx++] = '>';
+    pBuffer[bufferStartIdx++] = '/';
+
+    encodeBase91(pGpsData->gpggaData.altitudeMslMeters / 10 + MIC_E_ALTITUDE_OFFSET, &pBuffer[bufferStartIdx], 3);
+    bufferStartIdx += 3;
+    pBuffer[bufferStartIdx++] = '}';
+
+    const uint8_t telemetrySize = createCompressedTelemetry(gpsDataSource, pGpsData, pTelemetry, messageIdx, &pBuffer[bufferStartIdx], bufferSize - bufferStartIdx);
+    if (telemetrySize == 0)
+    {
+        return 0;
+    }
+
+    return bufferStartIdx + telemetrySize;
+}
+
+uint8_t createPayload(APRS_PAYLOAD_FORMAT payloadFormat,
+                      GpsDataSource gpsDataSource,
+                      const GpsData* pGpsData,
+                      const Telemetry* pTelemetry,
+                      uint16_t messageIdx,
+                      uint8_t* pHeader,
+                      uint8_t* pBuffer,
+                      uint8_t bufferSize)
+{
+    switch (payloadFormat)
+    {
+        case APF_COMPRESSED_COURSE_SPEED:
+        case APF_COMPRESSED_ALTITUDE:
+            return createCompressedPacketPayload(payloadFormat, gpsDataSource, pGpsData, pTelemetry, messageIdx, pBuffer, bufferSize);
+        case APF_MIC_E:
+            return createMicEPacketPayload(gpsDataSource, pGpsData, pTelemetry, messageIdx, pHeader, pBuffer, bufferSize);
+        case APF_UNCOMPRESSED:
+        default:
+            return createPacketPayload(gpsDataSource, pGpsData, pTelemetry, messageIdx, pBuffer, bufferSize);
+    }
+}
+
+uint8_t createFrameHeader(const Callsign* pCallsignSource, uint8_t* pBuffer, uint8_t bufferSize)
+{
+    if (!pCallsignSource || !pBuffer || bufferSize < AX25_HEADER_LEN)
+    {
+        return 0;
+    }
+
+    const Callsign* const addresses[3] = { &CALLSIGN_DESTINATION_1, pCallsignSource, &CALLSIGN_DESTINATION_2 };
+
+    uint8_t bufferIdx = 0;
+
+    // addresses to and from, callsign characters are shifted one bit left while ssid is already encoded
+
+    for (uint8_t iAddress = 0; iAddress < 3; ++iAddress)
+    {
+        for (uint8_t i = 0; i < AX25_ADDRESS_LEN - 1; ++i)
+        {
+            pBuffer[bufferIdx++] = addresses[iAddress]->callsign[i] << 1;
+        }
+        pBuffer[bufferIdx++] = addresses[iAddress]->ssid;
+    }
+
+    // control bytes
+
+    pBuffer[bufferIdx++] = AX25_CONTROL_UI_FRAME;
+    pBuffer[bufferIdx++] = AX25_PID_NO_LAYER_3;
+
+    return bufferIdx;
+}
+
+bool initializeFrameHeaderCache(const Callsign* pCallsignSource, FrameHeaderCache* pHeaderCache)
+{
+    if (!pCallsignSource || !pHeaderCache)
+    {
+        return false;
+    }
+
+    memset(pHeaderCache, 0, sizeof(FrameHeaderCache));
+
+    if (createFrameHeader(pCallsignSource, pHeaderCache->header, AX25_HEADER_LEN) == 0)
+    {
+        return false;
+    }
+
+    pHeaderCache->fcs = ax25FcsUpdate(FCS_INITIAL_VALUE, pHeaderCache->header, AX25_HEADER_LEN);
+    pHeaderCache->encodingData.lastBit = 1;
+
+    for (uint8_t i = 0; i < PREFIX_FLAGS_COUNT; ++i)
+    {
+        if (!encodeAndAppendBits(pHeaderCache->bitstream, APRS_HEADER_BITSTREAM_MAX_LEN, &pHeaderCache->encodingData, (const uint8_t*) "\x7E", 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO))
+        {
+            return false;
+        }
+    }
+
+    return encodeAndAppendBits(pHeaderCache->bitstream, APRS_HEADER_BITSTREAM_MAX_LEN, &pHeaderCache->encodingData, pHeaderCache->header, AX25_HEADER_LEN, ST_PERFORM_STUFFING, SHIFT_ONE_LEFT_NO);
+}
+
+bool appendFrameHeaderBitstream(const FrameHeaderCache* pHeaderCache, uint8_t* pBitstreamBuffer, uint16_t maxBitstreamBufferLen, EncodingData* pEncodingData)
+{
+    if (!pHeaderCache || !pBitstreamBuffer || !pEncodingData)
+    {
+        return false;
+    }
+
+    const BitstreamPos* const pHeaderSize = &pHeaderCache->encodingData.bitstreamSize;
+    const uint16_t headerBitstreamLen = pHeaderSize->bitstreamCharIdx + (pHeaderSize->bitstreamCharBitIdx ? 1 : 0);
+
+    const uint16_t charIdx = pEncodingData->bitstreamSize.bitstreamCharIdx;
+    const uint8_t bitIdx = pEncodingData->bitstreamSize.bitstreamCharBitIdx;
+
+    if (charIdx + headerBitstreamLen + (bitIdx ? 1 : 0) > maxBitstreamBufferLen)
+    {
+        return false;
+    }
+
+    // cached bitstream starts right after the bit 1, prefix flag resets number of ones so
+    // the only difference for any other state is the level of NRZI encoded bits
+
+    const uint8_t inversionMask = pEncodingData->lastBit ? 0x00 : 0xFF;
+
+    if (bitIdx == 0 && inversionMask == 0x00)
+    {
+        memcpy(&pBitstreamBuffer[charIdx], pHeaderCache->bitstream, headerBitstreamLen);
+    }
+    else if (bitIdx == 0)
+    {
+        for (uint16_t i = 0; i < headerBitstreamLen; ++i)
+        {
+            pBitstreamBuffer[charIdx + i] = pHeaderCache->bitstream[i] ^ inversionMask;
+        }
+    }
+    else
+    {
+        // keep already encoded bits of the current byte, bits above them are overwritten
+
+        pBitstreamBuffer[charIdx] &= (1 << bitIdx) - 1;
+
+        for (uint16_t i = 0; i < headerBitstreamLen; ++i)
+        {
+            const uint16_t value = (uint8_t) (pHeaderCache->bitstream[i] ^ inversionMask) << bitIdx;
+
+            pBitstreamBuffer[charIdx + i] |= value & 0xFF;
+            pBitstreamBuffer[charIdx + i + 1] = value >> 8;
+        }
+    }
+
+    const uint32_t bitstreamBitsCount = (charIdx + pHeaderSize->bitstreamCharIdx) * 8 + bitIdx + pHeaderSize->bitstreamCharBitIdx;
+
+    pEncodingData->bitstreamSize.bitstreamCharIdx = bitstreamBitsCount / 8;
+    pEncodingData->bitstreamSize.bitstreamCharBitIdx = bitstreamBitsCount % 8;
+    pEncodingData->lastBit = pHeaderCache->encodingData.lastBit ^ (inversionMask & 1);
+    pEncodingData->numberOfOnes = pHeaderCache->encodingData.numberOfOnes;
+
+    return true;
+}
+
+bool encodeAx25Frame(const FrameHeaderCache* pHeaderCache,
+                     const uint8_t* pFrame,
+                     uint16_t frameSize,
+                     uint8_t* bitstreamBuffer,
+                     uint16_t maxBitstreamBufferLen,
+                     EncodingData* pEncodingData)
+{
+    // payload format might put data into the header (Mic-E destination address),
+    // in this case cached header can't be used and whole frame has to be encoded
+
+    if (memcmp(pFrame, pHeaderCache->header, AX25_HEADER_LEN) != 0)
+    {
+        for (uint8_t i = 0; i < PREFIX_FLAGS_COUNT; ++i)
+        {
+            if (!encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, pEncodingData, (const uint8_t*) "\x7E", 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO))
+            {
+                return false;
+            }
+        }
+
+        return encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, pEncodingData, pFrame, frameSize, ST_PERFORM_STUFFING, SHIFT_ONE_LEFT_NO);
+    }
+
+    // bitstream continues with already encoded prefix flags and header, for frames
+    // of a burst prefix flags of the next frame also close the previous one
+
+    if (!appendFrameHeaderBitstream(pHeaderCache, bitstreamBuffer, maxBitstreamBufferLen, pEncodingData))
+    {
+        return false;
+    }
+
+    return encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, pEncodingData, &pFrame[AX25_HEADER_LEN], frameSize - AX25_HEADER_LEN, ST_PERFORM_STUFFING, SHIFT_ONE_LEFT_NO);
+}
+
+#ifdef APRS_FX25
+
+bool encodeFx25Frame(const FrameHeaderCache* pHeaderCache,
+                     const uint8_t* pFrame,
+                     uint16_t frameSize,
                      uint8_t* bitstreamBuffer,
                      uint16_t maxBitstreamBufferLen,
-                     BitstreamPos* pBitstreamSize)
+                     EncodingData* pEncodingData)
 {
-    if (!pBitstreamSize || !pCallsignSource || !pGpsData || !bitstreamBuffer)
+    // AX.25 frame with both flags is bit stuffed into codeblock buffer, NRZI is undone later
+
+    EncodingData ax25EncodingData = { 0 };
+    ax25EncodingData.lastBit = 1;
+
+    if (!encodeAx25Frame(pHeaderCache, pFrame, frameSize, g_fx25Codeblock, FX25_CODEBLOCK_BUFFER_LEN, &ax25EncodingData) ||
+        !encodeAndAppendBits(g_fx25Codeblock, FX25_CODEBLOCK_BUFFER_LEN, &ax25EncodingData, (const uint8_t*) "\x7E", 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO))
     {
         return false;
     }
-    
-    EncodingData encodingData = { 0 };
-    encodingData.lastBit = 1;
-    encodingData.fcs = FCS_INITIAL_VALUE;
 
-    for (uint8_t i = 0; i < PREFIX_FLAGS_COUNT; ++i)
+    const Fx25Mode* const pMode = fx25ModeForDataLen(ax25EncodingData.bitstreamSize.bitstreamCharIdx + (ax25EncodingData.bitstreamSize.bitstreamCharBitIdx ? 1 : 0));
+    if (!pMode)
     {
-        encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, (const uint8_t*) "\x7E", 1, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO);
+        // too long for any code, send it as plain AX.25 frame
+        return encodeAx25Frame(pHeaderCache, pFrame, frameSize, bitstreamBuffer, maxBitstreamBufferLen, pEncodingData);
     }
 
-    // addresses to and from
-    
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, CALLSIGN_DESTINATION_1.callsign, 6, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT);
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, &CALLSIGN_DESTINATION_1.ssid, 1, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT_NO);
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, pCallsignSource->callsign, 6, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT);
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, &pCallsignSource->ssid, 1, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT_NO);
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, CALLSIGN_DESTINATION_2.callsign, 6, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT);
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, &CALLSIGN_DESTINATION_2.ssid, 1, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT_NO);
+    // data is padded with flags
 
-    // control bytes
-    
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, (const uint8_t*) "\x03", 1, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT_NO);
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, (const uint8_t*) "\xF0", 1, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT_NO);
+    while (ax25EncodingData.bitstreamSize.bitstreamCharIdx < pMode->dataLen)
+    {
+        if (!encodeAndAppendBits(g_fx25Codeblock, FX25_CODEBLOCK_BUFFER_LEN, &ax25EncodingData, (const uint8_t*) "\x7E", 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO))
+        {
+            return false;
+        }
+    }
 
-    // packet contents
-    
-    const uint8_t bufferSize = createPacketPayload(gpsDataSource, pGpsData, pTelemetry, g_aprsMessageId++, g_aprsPayloadBuffer, APRS_PAYLOAD_LEN);
-    if (bufferSize == 0)
+    // bit 1 is "no level change", encoding started right after level 1
+
+    uint8_t previousLevel = 1;
+    for (uint8_t i = 0; i < pMode->dataLen; ++i)
+    {
+        const uint8_t levels = g_fx25Codeblock[i];
+        g_fx25Codeblock[i] = ~(levels ^ ((levels << 1) | previousLevel));
+        previousLevel = levels >> 7;
+    }
+
+    if (!fx25ReedSolomonEncode(g_fx25Codeblock, pMode->dataLen, &g_fx25Codeblock[pMode->dataLen]))
+    {
+        return false;
+    }
+
+    // correlation tag and codeblock are NRZI encoded without stuffing
+
+    uint8_t correlationTag[FX25_CORRELATION_TAG_LEN];
+    for (uint8_t i = 0; i < FX25_CORRELATION_TAG_LEN; ++i)
+    {
+        correlationTag[i] = (pMode->correlationTag >> (i * 8)) & 0xFF;
+    }
+
+    return encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, pEncodingData, correlationTag, FX25_CORRELATION_TAG_LEN, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO) &&
+           encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, pEncodingData, g_fx25Codeblock, pMode->dataLen + FX25_CHECK_BYTES_COUNT, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO);
+}
+
+#endif
+
+bool generateFrame(const FrameHeaderCache* pHeaderCache,
+                   const AprsMessage* pMessage,
+                   const Telemetry* pTelemetry,
+                   uint8_t* bitstreamBuffer,
+                   uint16_t maxBitstreamBufferLen,
+                   EncodingData* pEncodingData)
+{
+    if (!pHeaderCache || !pMessage || !pMessage->pGpsData || !bitstreamBuffer || !pEncodingData)
+    {
+        return false;
+    }
+
+    // raw frame, header is kept next to payload so frame buffer always has complete frame
+
+    memcpy(g_aprsFrameBuffer, pHeaderCache->header, AX25_HEADER_LEN);
+
+    uint8_t* const pPayload = &g_aprsFrameBuffer[AX25_HEADER_LEN];
+    const uint8_t payloadSize = createPayload(g_aprsPayloadFormat, pMessage->gpsDataSource, pMessage->pGpsData, pTelemetry, g_aprsMessageId++, g_aprsFrameBuffer, pPayload, APRS_PAYLOAD_LEN);
+    if (payloadSize == 0)
     {
         return false;
     }
 #ifdef DUMP_DATA_TO_UART0
     writeString(CHANNEL_OUTPUT, "aprs - ");
-    if (!writeMessageBuffer(CHANNEL_OUTPUT, g_aprsPayloadBuffer, bufferSize))
+    if (!writeMessageBuffer(CHANNEL_OUTPUT, pPayload, payloadSize))
     {
         return false;
     }
     writeString(CHANNEL_OUTPUT, "\r\n");
 #endif
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, g_aprsPayloadBuffer, bufferSize, ST_PERFORM_STUFFING, FCS_CALCULATE, SHIFT_ONE_LEFT_NO);
-    
-    // fcs
 
-    encodingData.fcs ^= FCS_POST_PROCESSING_XOR_VALUE;
-    uint8_t fcsByte = encodingData.fcs & 0x00FF; // get low byte
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, &fcsByte, 1, ST_PERFORM_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO);
-    fcsByte = (encodingData.fcs >> 8) & 0x00FF; // get high byte
-    encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, &fcsByte, 1, ST_PERFORM_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO);
+    // if header wasn't changed by payload its fcs is already known so only payload has to be added
+
+    uint16_t frameSize = AX25_HEADER_LEN + payloadSize;
+
+    const uint16_t fcs = memcmp(g_aprsFrameBuffer, pHeaderCache->header, AX25_HEADER_LEN) == 0 ?
+                         ax25FcsUpdate(pHeaderCache->fcs, pPayload, payloadSize) ^ FCS_POST_PROCESSING_XOR_VALUE :
+                         ax25Fcs(g_aprsFrameBuffer, frameSize);
+    g_aprsFrameBuffer[frameSize++] = fcs & 0x00FF; // low byte goes first
+    g_aprsFrameBuffer[frameSize++] = (fcs >> 8) & 0x00FF;
+
+#ifdef APRS_FX25
+    return encodeFx25Frame(pHeaderCache, g_aprsFrameBuffer, frameSize, bitstreamBuffer, maxBitstreamBufferLen, pEncodingData);
+#else
+    return encodeAx25Frame(pHeaderCache, g_aprsFrameBuffer, frameSize, bitstreamBuffer, maxBitstreamBufferLen, pEncodingData);
+#endif
+}
+
+bool generateMessage(const FrameHeaderCache* pHeaderCache,
+                     const AprsMessage* pMessages,
+                     uint8_t messagesCount,
+                     const Telemetry* pTelemetry,
+                     uint8_t* bitstreamBuffer,
+                     uint16_t maxBitstreamBufferLen,
+                     BitstreamPos* pBitstreamSize,
+                     uint8_t* pLastBit)
+{
+    if (!pBitstreamSize || !pLastBit || !pMessages || messagesCount == 0 || messagesCount > APRS_BURST_MAX_MESSAGES)
+    {
+        return false;
+    }
+
+    EncodingData encodingData = { 0 };
+    encodingData.lastBit = 1;
+
+    for (uint8_t i = 0; i < messagesCount; ++i)
+    {
+        if (!generateFrame(pHeaderCache, &pMessages[i], pTelemetry, bitstreamBuffer, maxBitstreamBufferLen, &encodingData))
+        {
+            return false;
+        }
+    }
 
     // sufix flags
 
     for (uint8_t i = 0; i < SUFFIX_FLAGS_COUNT; ++i)
     {
-        encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, (const uint8_t*) "\x7E", 1, ST_NO_STUFFING, FCS_NONE, SHIFT_ONE_LEFT_NO);
+        if (!encodeAndAppendBits(bitstreamBuffer, maxBitstreamBufferLen, &encodingData, (const uint8_t*) "\x7E", 1, ST_NO_STUFFING, SHIFT_ONE_LEFT_NO))
+        {
+            return false;
+        }
     }
 
     *pBitstreamSize = encodingData.bitstreamSize;
+    *pLastBit = encodingData.lastBit;
 
     return true;
 }
 
-float normalizePulseWidth(float width)
+uint32_t ddsPulseWidth(uint32_t phase)
 {
-    if (width < PWM_MIN_PULSE_WIDTH)
-    {
-        return PWM_MIN_PULSE_WIDTH;
-    }
-    else if (width > PWM_MAX_PULSE_WIDTH)
+    const uint32_t quadrant = phase >> DDS_QUADRANT_SHIFT;
+    const uint32_t idx = (phase >> DDS_QUARTER_WAVE_INDEX_SHIFT) & DDS_QUARTER_WAVE_INDEX_MASK;
+
+    switch (quadrant)
     {
-        return PWM_MAX_PULSE_WIDTH;
+        case 0:  return DDS_AMPLITUDE_SHIFT + DDS_QUARTER_WAVE_SINE[idx];
+        case 1:  return DDS_AMPLITUDE_SHIFT + DDS_QUARTER_WAVE_SINE[DDS_QUARTER_WAVE_TABLE_LEN - 1 - idx];
+        case 2:  return DDS_AMPLITUDE_SHIFT - DDS_QUARTER_WAVE_SINE[idx];
+        default: return DDS_AMPLITUDE_SHIFT - DDS_QUARTER_WAVE_SINE[DDS_QUARTER_WAVE_TABLE_LEN - 1 - idx];
     }
-    return width;
 }
 
 void Pwm10Handler(void)
@@ -436,8 +1135,17 @@ void Pwm10Handler(void)
         {
             g_currentSymbolPulsesCount = 0;
 
-            if (!g_sendingMessage || (g_currentBitstreamPos.bitstreamCharIdx >= g_currentBitstreamSize.bitstreamCharIdx && 
-                                      g_currentBitstreamPos.bitstreamCharBitIdx >= g_currentBitstreamSize.bitstreamCharBitIdx))
+            const BitstreamPos* const pBitstreamSize = &g_bitstreamBuffers[g_onAirBitstreamBufferIdx].size;
+
+            if (g_sendingMessage && g_currentBitstreamPos.bitstreamCharIdx >= pBitstreamSize->bitstreamCharIdx && 
+                                    g_currentBitstreamPos.bitstreamCharBitIdx >= pBitstreamSize->bitstreamCharBitIdx)
+            {
+                // next frame follows right after suffix flags of current one so there is no need
+                // to warm up HX1 again or to send leading ones
+                g_sendingMessage = switchToNextBitstreamBuffer();
+            }
+
+            if (!g_sendingMessage)
             {
                 disableAprsPwm();
                 disableHx1();
@@ -448,85 +1156,24 @@ void Pwm10Handler(void)
             else if (g_leadingOnesLeft)
             {
                 // send ones to stabilize HX1 and cancel any previosuly not-fully received APRS packets
-                g_currentFrequencyIsF1200 = true;
+                g_ddsPhaseIncrement = DDS_PHASE_INCREMENT_F1200;
                 --g_leadingOnesLeft;
             }
             else
             {
-                // bit stream is already AFSK encoded so we simply send ones and zeroes as is
-                const bool isOne = g_currentBitstream[g_currentBitstreamPos.bitstreamCharIdx] & (1 << g_currentBitstreamPos.bitstreamCharBitIdx);
+                // bit stream is already AFSK encoded so we simply send ones and zeroes as is,
+                // phase accumulator keeps going so tone switch doesn't introduce discontinuity
+                const uint8_t* const pBitstream = g_bitstreamBuffers[g_onAirBitstreamBufferIdx].bitstream;
+                const bool isOne = ((pBitstream[g_currentBitstreamPos.bitstreamCharIdx] & (1 << g_currentBitstreamPos.bitstreamCharBitIdx)) != 0) != g_invertBitstream;
 
-                // make sure new zero bit frequency is 2200
-                if (!isOne && g_currentFrequencyIsF1200)
-                {
-                    const float triagArg = ANGULAR_FREQUENCY_F1200 * g_currentF1200Frame;
-                    const float pulseWidth1200 = normalizePulseWidth(AMPLITUDE_SHIFT + AMPLITUDE_SCALER * SINE(triagArg));
-                    const bool pulse1200Positive = COSINE_G_THAN_0(triagArg);
-
-                    if (pulse1200Positive)
-                    {
-                        g_currentF2200Frame = RECIPROCAL_ANGULAR_FREQUENCY_F2200 * INVERSE_SINE(RECIPROCAL_AMPLITUDE_SCALER * (pulseWidth1200 - AMPLITUDE_SHIFT));
-                    }
-                    else
-                    {
-                        g_currentF2200Frame = HALF_PERIOD_F2200 - RECIPROCAL_ANGULAR_FREQUENCY_F2200 * INVERSE_SINE(RECIPROCAL_AMPLITUDE_SCALER * (pulseWidth1200 - AMPLITUDE_SHIFT));
-                    }
-                    
-                    if (g_currentF2200Frame < 0)
-                    {
-                        g_currentF2200Frame += F2200_PWM_PULSES_COUNT_PER_SYMBOL;
-                    }
-
-                    g_currentFrequencyIsF1200 = false;
-                }
-                // make sure new one bit frequency is 1200
-                else if (isOne && !g_currentFrequencyIsF1200)
-                {
-                    const float trigArg = ANGULAR_FREQUENCY_F2200 * g_currentF2200Frame;
-                    const float pulseWidth2200 = normalizePulseWidth(AMPLITUDE_SHIFT + AMPLITUDE_SCALER * SINE(trigArg));
-                    const bool pulse2200Positive = COSINE_G_THAN_0(trigArg);
-                    
-                    if (pulse2200Positive)
-                    {
-                        g_currentF1200Frame = RECIPROCAL_ANGULAR_FREQUENCY_F1200 * INVERSE_SINE(RECIPROCAL_AMPLITUDE_SCALER * (pulseWidth2200 - AMPLITUDE_SHIFT));
-                    }
-                    else
-                    {
-                        g_currentF1200Frame = HALF_PERIOD_F1200 - RECIPROCAL_ANGULAR_FREQUENCY_F1200 * INVERSE_SINE(RECIPROCAL_AMPLITUDE_SCALER * (pulseWidth2200 - AMPLITUDE_SHIFT));
-                    }
-
-                    if (g_currentF1200Frame < 0)
-                    {
-                        g_currentF1200Frame += F1200_PWM_PULSES_COUNT_PER_SYMBOL;
-                    }
-
-                    g_currentFrequencyIsF1200 = true;
-                }
+                g_ddsPhaseIncrement = isOne ? DDS_PHASE_INCREMENT_F1200 : DDS_PHASE_INCREMENT_F2200;
                 
                 advanceBitstreamBit(&g_currentBitstreamPos);
             }
         }
 
-        if (g_currentFrequencyIsF1200)
-        {
-            const uint32_t pulseWidth = (uint32_t) (AMPLITUDE_SHIFT + AMPLITUDE_SCALER * SINE(ANGULAR_FREQUENCY_F1200 * g_currentF1200Frame));
-            setAprsPwmPulseWidth(pulseWidth);
-            g_currentF1200Frame += PWM_STEP_SIZE;
-            if (g_currentF1200Frame >= F1200_PWM_PULSES_COUNT_PER_SYMBOL)
-            {
-                g_currentF1200Frame -= F1200_PWM_PULSES_COUNT_PER_SYMBOL;
-            }
-        }
-        else
-        {
-            const uint32_t pulseWidth = (uint32_t) (AMPLITUDE_SHIFT + AMPLITUDE_SCALER * SINE(ANGULAR_FREQUENCY_F2200 * g_currentF2200Frame));
-            setAprsPwmPulseWidth(pulseWidth);
-            g_currentF2200Frame += PWM_STEP_SIZE;
-            if (g_currentF2200Frame >= F2200_PWM_PULSES_COUNT_PER_SYMBOL)
-            {
-                g_currentF2200Frame -= F2200_PWM_PULSES_COUNT_PER_SYMBOL;
-            }
-        }
+        setAprsPwmPulseWidth(ddsPulseWidth(g_ddsPhase));
+        g_ddsPhase += g_ddsPhaseIncrement;
         
         ++g_currentSymbolPulsesCount;
     }
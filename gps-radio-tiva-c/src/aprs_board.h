@@ -14,6 +14,32 @@ extern const Callsign CALLSIGN_SOURCE;
 extern const Callsign CALLSIGN_DESTINATION_1;
 extern const Callsign CALLSIGN_DESTINATION_2;
 
+#define APRS_BURST_MAX_MESSAGES 2
+
+// every message of a burst is sent as a separate frame, frames are separated
+// only by flags so they share single HX1 warm up and leading ones
+typedef struct AprsMessage_t
+{
+    GpsDataSource gpsDataSource;
+    const GpsData* pGpsData;
+} AprsMessage;
+
+typedef enum APRS_PAYLOAD_FORMAT_t
+{
+    APF_UNCOMPRESSED = 0,        // DDMM.hhN/DDDMM.hhW>CCC/SSS position with T# telemetry and altitude comment
+    APF_COMPRESSED_COURSE_SPEED, // base-91 position with course and speed, |ss11223344| telemetry
+    APF_COMPRESSED_ALTITUDE,     // base-91 position with altitude, |ss11223344| telemetry
+    APF_MIC_E,                   // latitude in destination address, longitude, course, speed and altitude in 13 bytes, |ss11223344| telemetry
+} APRS_PAYLOAD_FORMAT;
+
 void initializeAprs(void);
 
-bool sendAprsMessage(GpsDataSource gpsDataSource, const GpsData* pGpsData, const Telemetry* pTelemetry);
+void setAprsPayloadFormat(APRS_PAYLOAD_FORMAT payloadFormat);
+
+// encodes messages into free bitstream buffer, doesn't key up transmitter
+bool prepareAprsMessage(const AprsMessage* pMessages, uint8_t messagesCount, const Telemetry* pTelemetry);
+
+// sends prepared messages, if transmitter is already on air they follow current ones without gap
+bool transmitAprsMessage(void);
+
+bool sendAprsMessage(const AprsMessage* pMessages, uint8_t messagesCount, const Telemetry* pTelemetry);
@@ -1,34 +1,100 @@
 #pragma once
 
 #include "aprs_board.h"
+#include "ax25_fcs.h"
+#include "fx25.h"
 
 #define PREFIX_FLAGS_COUNT 1
 #define SUFFIX_FLAGS_COUNT 10
 
-#define APRS_BITSTREAM_MAX_LEN 386 // bitstream will have extra bits in it so it must be larger than message buffer
-                                   // in worst case we will insert extra 0 for every 5 bits
-
 #define APRS_PAYLOAD_LEN 128
 
+#define APRS_BITSTREAM_BUFFERS_COUNT 2 // one is on air while the next one is being prepared
+
 /*
- * FCS
+ * AX.25 frame (without flags)
  */
- 
-#define FCS_POLYNOMIAL 0x8408
-#define FCS_INITIAL_VALUE 0xFFFF
-#define FCS_POST_PROCESSING_XOR_VALUE 0xFFFF
+
+#define AX25_ADDRESS_LEN 7
+#define AX25_HEADER_LEN (3 * AX25_ADDRESS_LEN + 2) // destination, source, digipeater, control and PID
+#define AX25_FCS_LEN 2
+
+#define AX25_CONTROL_UI_FRAME 0x03
+#define AX25_PID_NO_LAYER_3 0xF0
+
+#define APRS_FRAME_MAX_LEN (AX25_HEADER_LEN + APRS_PAYLOAD_LEN + AX25_FCS_LEN)
+
+// prefix flags and stuffed header, in worst case extra 0 is inserted for every 5 bits
+#define APRS_HEADER_BITSTREAM_MAX_LEN ((PREFIX_FLAGS_COUNT * 8 + AX25_HEADER_LEN * 8 * 6 / 5) / 8 + 1)
+
+// prefix flags and stuffed frame for every message of a burst followed by suffix flags
+#define AX25_FRAME_BITSTREAM_MAX_LEN (PREFIX_FLAGS_COUNT + APRS_FRAME_MAX_LEN * 8 * 6 / 5 / 8 + 1)
+
+#ifdef APRS_FX25
+    // correlation tag and the longest codeblock, frame which doesn't fit is sent as it is
+    #define APRS_FRAME_BITSTREAM_MAX_LEN (FX25_CORRELATION_TAG_LEN + FX25_MAX_CODEBLOCK_LEN)
+#else
+    #define APRS_FRAME_BITSTREAM_MAX_LEN AX25_FRAME_BITSTREAM_MAX_LEN
+#endif
+
+// stuffed frame with both flags before NRZI is decoded, padding flags may go one byte past data
+#define FX25_CODEBLOCK_BUFFER_LEN (FX25_MAX_CODEBLOCK_LEN + 1)
+#define APRS_BITSTREAM_MAX_LEN (APRS_BURST_MAX_MESSAGES * APRS_FRAME_BITSTREAM_MAX_LEN + SUFFIX_FLAGS_COUNT)
 
 /*
- * PWM
+ * Uncompressed payload, every field has fixed width so space is checked once per group of fields
  */
 
+#define APRS_TIMESTAMP_LEN 8    // @hhmmssz
+#define APRS_POSITION_LEN 19    // DDMM.hhN/DDDMM.hhW
+#define APRS_COURSE_SPEED_LEN 8 // >CCC/SSS
+#define APRS_TELEMETRY_LEN 42   // T#sss,111,222,333,000,000,00000000 a=AAAAA
+
+#define APRS_TELEMETRY_UNUSED_FIELDS ",000,000,00000000 a="
+
 /*
- * those values are calculated in advance depending on MCU/etc
+ * Compressed position (APRS101 chapter 9)
+ */
+
+#define BASE91_FIRST_CHAR '!'
+#define BASE91_MAX_2_CHARS_VALUE (91 * 91 - 1)
+
+#define COMPRESSED_LATITUDE_SCALE 380926  // per degree from 90N
+#define COMPRESSED_LONGITUDE_SCALE 190463 // per degree from 180W
+#define COMPRESSED_MICRO_MINUTES_PER_DEGREE 60000000
+
+#define COMPRESSED_MAX_COURSE_SPEED_VALUE 89
+
+// compression type, current fix and software origin, altitude requires GGA as NMEA source
+#define COMPRESSED_TYPE_COURSE_SPEED (0x20 | 0x00 | 0x02)
+#define COMPRESSED_TYPE_ALTITUDE     (0x20 | 0x10 | 0x02)
+
+#define COMPRESSED_ALTITUDE_POWERS_COUNT 14 // 1.002^8191 is above any reachable altitude
+#define COMPRESSED_SPEED_POWERS_COUNT 7
+
+#define COMPRESSED_TELEMETRY_LEN 12 // |ss11223344|
+
+/*
+ * Mic-E (APRS101 chapter 10)
  */
 
-#define PI 3.141592654f
+#define MIC_E_DESTINATION_SSID '\xE0' // 111 0000 0
+                                      //          ^ not a last address
+                                      //     ^^^^ SSID (0 - path is set by digipeater address)
+                                      // ^^^ some reserved values and command/response
+#define MIC_E_MESSAGE_BITS 0x06       // A B C = 110 (en route), standard message
+#define MIC_E_CURRENT_GPS_DATA '`'
+#define MIC_E_CHAR_OFFSET 28
+#define MIC_E_ALTITUDE_OFFSET 10000   // meters, altitude is sent as 3 base-91 digits followed by }
+#define MIC_E_LEN 13                  // data type, longitude, speed, course, symbol and altitude
 
-#define PWM_STEP_SIZE 1
+/*
+ * PWM
+ */
+
+/*
+ * those values are calculated in advance depending on MCU/etc
+ */
 
 #define PWM_PERIOD 650
 #define PWM_MIN_PULSE_WIDTH 1
@@ -42,30 +108,38 @@
 #define LEADING_ONES_COUNT_TO_CANCEL_PREVIOUS_PACKET 48
 
 /*
- * those values are calculated from prevous ones
+ * DDS
+ *
+ * AFSK tones are generated by a 32-bit phase accumulator which is advanced by a per-tone
+ * increment on every PWM pulse. Top bits of the phase select a quadrant and an entry in
+ * a quarter-wave sine table, so switching tones keeps the phase continuous for free.
  */
 
-#define F2200_PWM_PULSES_COUNT_PER_SYMBOL (1200.0f * F1200_PWM_PULSES_COUNT_PER_SYMBOL / 2200.0f)
-
-#define AMPLITUDE_SCALER ((float) (PWM_MAX_PULSE_WIDTH - PWM_MIN_PULSE_WIDTH) / 2.0f)
-#define RECIPROCAL_AMPLITUDE_SCALER (1.0f / AMPLITUDE_SCALER)
+#define DDS_QUARTER_WAVE_TABLE_BITS 6
+#define DDS_QUARTER_WAVE_TABLE_LEN ((1 << DDS_QUARTER_WAVE_TABLE_BITS) + 1) // extra entry for sin(pi / 2)
+#define DDS_QUARTER_WAVE_INDEX_MASK ((1 << DDS_QUARTER_WAVE_TABLE_BITS) - 1)
+#define DDS_QUARTER_WAVE_INDEX_SHIFT (32 - 2 - DDS_QUARTER_WAVE_TABLE_BITS)
+#define DDS_QUADRANT_SHIFT 30
 
-#define AMPLITUDE_SHIFT ((float) (AMPLITUDE_SCALER + 1.0f))
+#define DDS_PHASE_INCREMENT_F1200 ((uint32_t) (0x100000000ULL / F1200_PWM_PULSES_COUNT_PER_SYMBOL))
+#define DDS_PHASE_INCREMENT_F2200 ((uint32_t) (0x100000000ULL * 2200 / (1200 * F1200_PWM_PULSES_COUNT_PER_SYMBOL)))
 
-#define HALF_PERIOD_F1200 (F1200_PWM_PULSES_COUNT_PER_SYMBOL / 2.0f)
-#define HALF_PERIOD_F2200 (F2200_PWM_PULSES_COUNT_PER_SYMBOL / 2.0f)
+#define DDS_AMPLITUDE ((PWM_MAX_PULSE_WIDTH - PWM_MIN_PULSE_WIDTH) / 2)
+#define DDS_AMPLITUDE_SHIFT (DDS_AMPLITUDE + PWM_MIN_PULSE_WIDTH)
 
-#define ANGULAR_FREQUENCY_F1200 (2.0f * PI / F1200_PWM_PULSES_COUNT_PER_SYMBOL)
-#define ANGULAR_FREQUENCY_F2200 (2200.0f * ANGULAR_FREQUENCY_F1200 / 1200.0f)
+/*
+ * Bitstream encoding
+ */
 
-#define RECIPROCAL_ANGULAR_FREQUENCY_F1200 (1.0f / ANGULAR_FREQUENCY_F1200) 
-#define RECIPROCAL_ANGULAR_FREQUENCY_F2200 (1.0f / ANGULAR_FREQUENCY_F2200) 
+// zero is inserted after this many consecutive ones
+#define STUFFING_MAX_ONES 5
 
-typedef enum FCS_TYPE_t
-{
-    FCS_NONE,
-    FCS_CALCULATE,
-} FCS_TYPE;
+// STUFFING_ONES_RUNS entries: low nibble - ones at the start of the byte (LSB first) or
+// STUFFING_ALWAYS if byte has a run which needs stuffing no matter what was before it,
+// high nibble - ones at the end of the byte
+#define STUFFING_ALWAYS 0x0F
+#define STUFFING_LEADING_ONES(runs) ((runs) & 0x0F)
+#define STUFFING_TRAILING_ONES(runs) ((runs) >> 4)
 
 typedef enum STUFFING_TYPE_t
 {
@@ -87,15 +161,48 @@ typedef struct BitstreamPos_t
 
 typedef struct EncodingData_t
 {
-    uint16_t fcs;
     uint8_t lastBit;
     uint8_t numberOfOnes;
     BitstreamPos bitstreamSize;
 } EncodingData;
 
+/*
+ * Prefix flags and header are the same for every frame, so they are encoded once
+ * and every frame starts from the copy of this bitstream and encoding state
+ */
+typedef struct FrameHeaderCache_t
+{
+    uint16_t fcs; // not post processed
+    EncodingData encodingData;
+    uint8_t header[AX25_HEADER_LEN];
+    uint8_t bitstream[APRS_HEADER_BITSTREAM_MAX_LEN];
+} FrameHeaderCache;
+
+/*
+ * Bitstream buffer ownership is handed off between main loop and Pwm10Handler:
+ * FREE -> PREPARED (main loop) -> QUEUED (main loop) -> ON_AIR (ISR) -> FREE (ISR)
+ */
+typedef enum BITSTREAM_BUFFER_STATE_t
+{
+    BBS_FREE = 0,
+    BBS_PREPARED,
+    BBS_QUEUED,
+    BBS_ON_AIR,
+} BITSTREAM_BUFFER_STATE;
+
+typedef struct BitstreamBuffer_t
+{
+    volatile BITSTREAM_BUFFER_STATE state;
+    BitstreamPos size;
+    uint8_t lastBit; // NRZI level bitstream ends at
+    uint8_t bitstream[APRS_BITSTREAM_MAX_LEN];
+} BitstreamBuffer;
+
 void advanceBitstreamBit(BitstreamPos* pResultBitstreamSize);
 
-float normalizePulseWidth(float width);
+extern const uint16_t DDS_QUARTER_WAVE_SINE[DDS_QUARTER_WAVE_TABLE_LEN];
+
+uint32_t ddsPulseWidth(uint32_t phase);
 
 bool encodeAndAppendBits(uint8_t* pBitstreamBuffer,
                          uint16_t maxBitstreamBufferLen,
@@ -103,17 +210,100 @@ bool encodeAndAppendBits(uint8_t* pBitstreamBuffer,
                          const uint8_t* pMessageData,
                          uint16_t messageDataSize,
                          STUFFING_TYPE stuffingType,
-                         FCS_TYPE fcsType,
                          SHIFT_ONE_LEFT_TYPE shiftOneLeftType);
 
+uint8_t createFrameHeader(const Callsign* pCallsignSource, uint8_t* pBuffer, uint8_t bufferSize);
+
+bool initializeFrameHeaderCache(const Callsign* pCallsignSource, FrameHeaderCache* pHeaderCache);
+
+bool appendFrameHeaderBitstream(const FrameHeaderCache* pHeaderCache, uint8_t* pBitstreamBuffer, uint16_t maxBitstreamBufferLen, EncodingData* pEncodingData);
+
+// writes exactly width digits with leading zeroes, digits which don't fit are dropped
+uint8_t formatDecimal(uint32_t value, uint8_t width, uint8_t* pBuffer);
+
+uint8_t formatTimestamp(const GpsTime* pTime, uint8_t* pBuffer);
+
+uint8_t formatAngularCoordinate(const AngularCoordinate* pCoordinate, uint8_t degreesWidth, uint8_t* pBuffer);
+
 uint8_t createPacketPayload(GpsDataSource gpsDataSource, const GpsData* pGpsData, const Telemetry* pTelemetry, uint16_t messageIdx, uint8_t* pBuffer, uint8_t bufferSize);
 
-bool generateMessage(const Callsign* pCallsignSource,
-                     GpsDataSource gpsDataSource,
-                     const GpsData* pGpsData,
+void encodeBase91(uint32_t value, uint8_t* pBuffer, uint8_t digitsCount);
+
+uint32_t compressedLatitude(const AngularCoordinate* pLatitude);
+uint32_t compressedLongitude(const AngularCoordinate* pLongitude);
+
+extern const float COMPRESSED_ALTITUDE_POWERS[COMPRESSED_ALTITUDE_POWERS_COUNT];
+extern const float COMPRESSED_SPEED_POWERS[COMPRESSED_SPEED_POWERS_COUNT];
+
+// returns n for which base^n is the nearest to value, pPowers holds base^(2^i)
+uint16_t compressedLogarithm(float value, const float* pPowers, uint8_t powersCount, uint16_t maxResult);
+
+uint8_t createCompressedPacketPayload(APRS_PAYLOAD_FORMAT payloadFormat,
+                                      GpsDataSource gpsDataSource,
+                                      const GpsData* pGpsData,
+                                      const Telemetry* pTelemetry,
+                                      uint16_t messageIdx,
+                                      uint8_t* pBuffer,
+                                      uint8_t bufferSize);
+
+uint8_t createCompressedTelemetry(GpsDataSource gpsDataSource,
+                                  const GpsData* pGpsData,
+                                  const Telemetry* pTelemetry,
+                                  uint16_t messageIdx,
+                                  uint8_t* pBuffer,
+                                  uint8_t bufferSize);
+
+// latitude, message bits and hemispheres in destination address characters (not shifted)
+void createMicEDestination(const AngularCoordinate* pLatitude, const AngularCoordinate* pLongitude, uint8_t* pDestination);
+
+// destination address of the header is replaced when position is known
+uint8_t createMicEPacketPayload(GpsDataSource gpsDataSource,
+                                const GpsData* pGpsData,
+                                const Telemetry* pTelemetry,
+                                uint16_t messageIdx,
+                                uint8_t* pHeader,
+                                uint8_t* pBuffer,
+                                uint8_t bufferSize);
+
+uint8_t createPayload(APRS_PAYLOAD_FORMAT payloadFormat,
+                      GpsDataSource gpsDataSource,
+                      const GpsData* pGpsData,
+                      const Telemetry* pTelemetry,
+                      uint16_t messageIdx,
+                      uint8_t* pHeader,
+                      uint8_t* pBuffer,
+                      uint8_t bufferSize);
+
+bool encodeAx25Frame(const FrameHeaderCache* pHeaderCache,
+                     const uint8_t* pFrame,
+                     uint16_t frameSize,
+                     uint8_t* bitstreamBuffer,
+                     uint16_t maxBitstreamBufferLen,
+                     EncodingData* pEncodingData);
+
+bool encodeFx25Frame(const FrameHeaderCache* pHeaderCache,
+                     const uint8_t* pFrame,
+                     uint16_t frameSize,
+                     uint8_t* bitstreamBuffer,
+                     uint16_t maxBitstreamBufferLen,
+                     EncodingData* pEncodingData);
+
+bool generateFrame(const FrameHeaderCache* pHeaderCache,
+                   const AprsMessage* pMessage,
+                   const Telemetry* pTelemetry,
+                   uint8_t* bitstreamBuffer,
+                   uint16_t maxBitstreamBufferLen,
+                   EncodingData* pEncodingData);
+
+bool generateMessage(const FrameHeaderCache* pHeaderCache,
+                     const AprsMessage* pMessages,
+                     uint8_t messagesCount,
                      const Telemetry* pTelemetry,
                      uint8_t* bitstreamBuffer,
                      uint16_t maxBitstreamBufferLen,
-                     BitstreamPos* pBitstreamSize);
+                     BitstreamPos* pBitstreamSize,
+                     uint8_t* pLastBit);
+
+bool switchToNextBitstreamBuffer(void);
 
 void Pwm10Handler(void);
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * AX.25 frame check sequence (CRC-16/X.25, reflected polynomial 0x8408)
+ *
+ * FCS is calculated over raw frame bytes (addresses, control, PID and information field)
+ * before bit stuffing and NRZI are applied. Low byte of the result is sent first.
+ *
+ * AX25_FCS_NIBBLE_TABLE
+ * - defined:     16 entry table is used (32 bytes of flash, two lookups per byte)
+ * - not defined: 256 entry table is used (512 bytes of flash, one lookup per byte)
+ */
+
+#define FCS_POLYNOMIAL 0x8408
+#define FCS_INITIAL_VALUE 0xFFFF
+#define FCS_POST_PROCESSING_XOR_VALUE 0xFFFF
+
+// continues FCS calculation from the given state, no post processing is done
+uint16_t ax25FcsUpdate(uint16_t fcs, const uint8_t* pData, uint16_t size);
+
+// complete FCS of the data ready to be appended to the frame
+uint16_t ax25Fcs(const uint8_t* pData, uint16_t size);
@@ -18,6 +18,12 @@
 // If altitude is less than 3000 m ASL, frequency increases to 15 seconds
 #define RADIO_MCU_LOW_ALTITUDE 3000
 #define RADIO_MCU_MESSAGE_FAST_INTERVAL 15
+// Message is encoded 1 second ahead so only key up is left for its time slot
+#define RADIO_MCU_MESSAGE_PREPARE_AHEAD 1
+// Switch to binary output is sent to Venus every 2 seconds until it is confirmed
+#define VENUS_CONFIGURATION_RETRY_INTERVAL 2
+// Switch to TSIP output is sent to Copernicus every 2 seconds until it is confirmed
+#define COPERNICUS_CONFIGURATION_RETRY_INTERVAL 2
 
 typedef enum GpsDataSource_t
 {
@@ -0,0 +1,108 @@
+#include "fx25.h"
+
+#include <string.h>
+
+#define FX25_GF_SIZE 255
+#define FX25_GF_LOG_OF_ZERO FX25_GF_SIZE
+
+static const Fx25Mode FX25_MODES[] =
+{
+    { 0x8F056EB4369660EEULL, 32 },  // Tag_04, RS(48, 32)
+    { 0xC7DC0508F3D9B09EULL, 64 },  // Tag_03, RS(80, 64)
+    { 0x26FF60A600CC8FDEULL, 128 }, // Tag_02, RS(144, 128)
+    { 0xB74DB7DF8A532F3EULL, 239 }, // Tag_01, RS(255, 239)
+};
+
+static uint8_t g_gfExp[FX25_GF_SIZE];
+static uint8_t g_gfLog[FX25_GF_SIZE + 1];
+static uint8_t g_generatorLog[FX25_CHECK_BYTES_COUNT + 1]; // coefficients of generator polynomial in log form
+static bool g_isFx25Initialized = false;
+
+void initializeFx25(void)
+{
+    // exp and log tables of GF(256)
+
+    uint16_t value = 1;
+    for (uint16_t i = 0; i < FX25_GF_SIZE; ++i)
+    {
+        g_gfExp[i] = (uint8_t) value;
+        g_gfLog[value] = (uint8_t) i;
+        value <<= 1;
+        if (value & 0x100)
+        {
+            value ^= FX25_GF_POLYNOMIAL;
+        }
+    }
+    g_gfLog[0] = FX25_GF_LOG_OF_ZERO;
+
+    // generator polynomial is product of (x - a^(root + i)), highest coefficient is always 1
+
+    uint8_t generator[FX25_CHECK_BYTES_COUNT + 1] = { 1 };
+
+    for (uint8_t i = 0; i < FX25_CHECK_BYTES_COUNT; ++i)
+    {
+        const uint8_t rootLog = (FX25_FIRST_CONSECUTIVE_ROOT + i) % FX25_GF_SIZE;
+
+        generator[i + 1] = 1;
+        for (uint8_t j = i; j > 0; --j)
+        {
+            generator[j] = generator[j - 1] ^ (generator[j] ? g_gfExp[(g_gfLog[generator[j]] + rootLog) % FX25_GF_SIZE] : 0);
+        }
+        generator[0] = g_gfExp[(g_gfLog[generator[0]] + rootLog) % FX25_GF_SIZE];
+    }
+
+    for (uint8_t i = 0; i <= FX25_CHECK_BYTES_COUNT; ++i)
+    {
+        g_generatorLog[i] = g_gfLog[generator[i]];
+    }
+
+    g_isFx25Initialized = true;
+}
+
+const Fx25Mode* fx25ModeForDataLen(uint16_t dataLen)
+{
+    for (uint8_t i = 0; i < sizeof(FX25_MODES) / sizeof(FX25_MODES[0]); ++i)
+    {
+        if (dataLen <= FX25_MODES[i].dataLen)
+        {
+            return &FX25_MODES[i];
+        }
+    }
+    return 0;
+}
+
+bool fx25ReedSolomonEncode(const uint8_t* pData, uint8_t dataLen, uint8_t* pCheckBytes)
+{
+    if (!pData || !pCheckBytes || dataLen > FX25_MAX_DATA_LEN)
+    {
+        return false;
+    }
+
+    if (!g_isFx25Initialized)
+    {
+        initializeFx25();
+    }
+
+    // systematic encoder, check bytes are remainder of division by generator polynomial,
+    // shortened code simply has leading zero data bytes which don't change the remainder
+
+    memset(pCheckBytes, 0, FX25_CHECK_BYTES_COUNT);
+
+    for (uint8_t i = 0; i < dataLen; ++i)
+    {
+        const uint8_t feedback = g_gfLog[pData[i] ^ pCheckBytes[0]];
+
+        if (feedback != FX25_GF_LOG_OF_ZERO)
+        {
+            for (uint8_t j = 1; j < FX25_CHECK_BYTES_COUNT; ++j)
+            {
+                pCheckBytes[j] ^= g_gfExp[(feedback + g_generatorLog[FX25_CHECK_BYTES_COUNT - j]) % FX25_GF_SIZE];
+            }
+        }
+
+        memmove(pCheckBytes, &pCheckBytes[1], FX25_CHECK_BYTES_COUNT - 1);
+        pCheckBytes[FX25_CHECK_BYTES_COUNT - 1] = feedback != FX25_GF_LOG_OF_ZERO ? g_gfExp[(feedback + g_generatorLog[0]) % FX25_GF_SIZE] : 0;
+    }
+
+    return true;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * FX.25 forward error correction
+ *
+ * Bit stuffed AX.25 frame with its flags (before NRZI) is padded with flags up to data length
+ * of one of the Reed-Solomon codes and followed by check bytes. Correlation tag sent in front
+ * of it tells FX.25 receivers which code is used, legacy receivers see just an AX.25 frame
+ * surrounded by noise.
+ *
+ * Only shortened RS(255, 239) codes with 16 check bytes are used. GF(256) tables are built
+ * by initializeFx25() in RAM so they don't take 512 bytes of flash.
+ */
+
+#define FX25_CORRELATION_TAG_LEN 8
+#define FX25_CHECK_BYTES_COUNT 16
+#define FX25_MAX_DATA_LEN 239
+#define FX25_MAX_CODEBLOCK_LEN (FX25_MAX_DATA_LEN + FX25_CHECK_BYTES_COUNT)
+
+#define FX25_GF_POLYNOMIAL 0x11D  // x^8 + x^4 + x^3 + x^2 + 1
+#define FX25_FIRST_CONSECUTIVE_ROOT 1
+
+typedef struct Fx25Mode_t
+{
+    uint64_t correlationTag; // sent low byte first
+    uint8_t dataLen;
+} Fx25Mode;
+
+void initializeFx25(void);
+
+// the shortest code which fits data, null if data is too long
+const Fx25Mode* fx25ModeForDataLen(uint16_t dataLen);
+
+// writes FX25_CHECK_BYTES_COUNT check bytes for the data
+bool fx25ReedSolomonEncode(const uint8_t* pData, uint8_t dataLen, uint8_t* pCheckBytes);
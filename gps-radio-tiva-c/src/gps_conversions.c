@@ -0,0 +1,105 @@
+#include "gps_conversions.h"
+
+#include <math.h>
+#include <string.h>
+
+uint16_t readBigEndianUint16(const uint8_t* pData)
+{
+    return (uint16_t) ((pData[0] << 8) | pData[1]);
+}
+
+uint32_t readBigEndianUint32(const uint8_t* pData)
+{
+    return ((uint32_t) pData[0] << 24) | ((uint32_t) pData[1] << 16) | ((uint32_t) pData[2] << 8) | pData[3];
+}
+
+float readBigEndianFloat(const uint8_t* pData)
+{
+    const uint32_t bits = readBigEndianUint32(pData);
+    float result;
+
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+double readBigEndianDouble(const uint8_t* pData)
+{
+    const uint64_t bits = ((uint64_t) readBigEndianUint32(pData) << 32) | readBigEndianUint32(pData + 4);
+    double result;
+
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+void gpsWeekTimeToUtc(uint16_t week, uint32_t timeOfWeekCentiseconds, uint8_t utcOffsetSeconds, GpsTime* pTime, GpsDate* pDate)
+{
+    if (week < GPS_WEEK_ROLLOVER)
+    {
+        week += GPS_WEEK_ERA_START;
+    }
+
+    const uint32_t timeOfWeekSeconds = timeOfWeekCentiseconds / 100;
+    if (timeOfWeekSeconds >= GPS_SECONDS_PER_WEEK)
+    {
+        pTime->isValid = false;
+        pDate->isValid = false;
+        return;
+    }
+
+    // seconds since GPS epoch fit 32 bits until 2116
+    const uint32_t seconds = (uint32_t) week * GPS_SECONDS_PER_WEEK + timeOfWeekSeconds - utcOffsetSeconds;
+    const uint32_t secondsOfDay = seconds % GPS_SECONDS_PER_DAY;
+
+    pTime->isValid = true;
+    pTime->hours = (uint8_t) (secondsOfDay / 3600);
+    pTime->minutes = (uint8_t) (secondsOfDay / 60 % 60);
+    pTime->seconds = (fixedPointW2F2_t) (secondsOfDay % 60 * 100 + timeOfWeekCentiseconds % 100);
+
+    // civil date from days since 1970-01-01 (proleptic Gregorian calendar, 400 year eras starting on March 1st)
+    const uint32_t days = seconds / GPS_SECONDS_PER_DAY + GPS_EPOCH_DAYS_SINCE_1970 + 719468;
+    const uint32_t era = days / 146097;
+    const uint32_t dayOfEra = days - era * 146097;
+    const uint32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const uint32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const uint32_t shiftedMonth = (5 * dayOfYear + 2) / 153;
+    const uint32_t month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+
+    pDate->isValid = true;
+    pDate->day = (uint8_t) (dayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
+    pDate->month = (uint8_t) month;
+    pDate->year = (uint16_t) (yearOfEra + era * 400 + (month <= 2 ? 1 : 0));
+}
+
+void degreesE7ToAngularCoordinate(int32_t degreesE7, bool isLatitude, AngularCoordinate* pCoordinate)
+{
+    const uint32_t absoluteDegreesE7 = degreesE7 < 0 ? (uint32_t) -(int64_t) degreesE7 : (uint32_t) degreesE7;
+
+    pCoordinate->isValid = absoluteDegreesE7 <= (isLatitude ? 90U : 180U) * GPS_DEGREES_E7_PER_DEGREE;
+    pCoordinate->degrees = (uint8_t) (absoluteDegreesE7 / GPS_DEGREES_E7_PER_DEGREE);
+    // 10^-7 degree is exactly 6 * 10^-6 minute
+    pCoordinate->minutes = absoluteDegreesE7 % GPS_DEGREES_E7_PER_DEGREE * GPS_MINUTES_UNITS_PER_DEGREE_E7;
+
+    if (isLatitude)
+    {
+        pCoordinate->hemisphere = degreesE7 < 0 ? H_SOUTH : H_NORTH;
+    }
+    else
+    {
+        pCoordinate->hemisphere = degreesE7 < 0 ? H_WEST : H_EAST;
+    }
+}
+
+void horizontalVelocityToGpvtg(float eastMetersPerSecond, float northMetersPerSecond, GpvtgData* pGpvtgData)
+{
+    // 1 m/s is 3.6 kph, W3F1 has one fractional digit
+    const float speedKph = sqrtf(eastMetersPerSecond * eastMetersPerSecond + northMetersPerSecond * northMetersPerSecond) * 36.0f + 0.5f;
+    pGpvtgData->speedKph = speedKph < 65535.0f ? (fixedPointW3F1_t) speedKph : 65535;
+
+    float course = atan2f(eastMetersPerSecond, northMetersPerSecond) * (1800.0f / 3.14159265f) + 0.5f;
+    if (course < 0.0f)
+    {
+        course += 3600.0f;
+    }
+    const fixedPointW3F1_t trueCourseDegrees = (fixedPointW3F1_t) course;
+    pGpvtgData->trueCourseDegrees = trueCourseDegrees >= 3600 ? trueCourseDegrees - 3600 : trueCourseDegrees;
+}
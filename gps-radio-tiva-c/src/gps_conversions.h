@@ -0,0 +1,38 @@
+#pragma once
+
+/*
+ * Conversions of the values reported by binary GPS protocols (week/time of week, degrees, velocity vectors)
+ * to the NMEA based representation which is used by APRS and I2C
+ */
+
+#include "nmea_messages.h"
+
+// GPS time is ahead of UTC by the number of leap seconds, used by protocols which don't report the offset
+#define GPS_UTC_LEAP_SECONDS       18
+
+// days from 1970-01-01 to GPS epoch 1980-01-06
+#define GPS_EPOCH_DAYS_SINCE_1970  3657
+#define GPS_SECONDS_PER_DAY        86400
+#define GPS_SECONDS_PER_WEEK       604800
+
+// 10 bit week numbers are taken to be in the era which started with 2019-04-07 rollover
+#define GPS_WEEK_ROLLOVER          1024
+#define GPS_WEEK_ERA_START         2048
+
+#define GPS_DEGREES_E7_PER_DEGREE  10000000
+#define GPS_MINUTES_UNITS_PER_DEGREE_E7 6 // fixedPointW2F6_t minutes
+
+// binary protocols send multi-byte values most significant byte first, floats are IEEE 754
+uint16_t readBigEndianUint16(const uint8_t* pData);
+uint32_t readBigEndianUint32(const uint8_t* pData);
+float readBigEndianFloat(const uint8_t* pData);
+double readBigEndianDouble(const uint8_t* pData);
+
+// time of week is in 1/100 of second, leap seconds are subtracted to get UTC
+void gpsWeekTimeToUtc(uint16_t week, uint32_t timeOfWeekCentiseconds, uint8_t utcOffsetSeconds, GpsTime* pTime, GpsDate* pDate);
+
+// degrees times 10^7, negative for southern and western hemispheres
+void degreesE7ToAngularCoordinate(int32_t degreesE7, bool isLatitude, AngularCoordinate* pCoordinate);
+
+// horizontal velocity in meters per second to speed over ground and true course
+void horizontalVelocityToGpvtg(float eastMetersPerSecond, float northMetersPerSecond, GpvtgData* pGpvtgData);
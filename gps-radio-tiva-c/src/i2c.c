@@ -21,13 +21,36 @@
  * [0x1A-0x1B] - HDG 1 - Heading as unsigned 16 bit integer in degrees * 10 [true] LSB first
  * [0x1C-0x1F]  ALT 1  Altitude as signed 32-bit integer in cm LSB first
  * [0x20]  SAT 1  # satellites visible or 0 if no fix
- * [0x21-0x2F]  RESERVED
+ * [0x21-0x22] - HDOP 1 - Horizontal dilution of precision as unsigned 16 bit integer * 100 LSB first
+ * [0x23] - SNR MEAN 1 - Mean SNR of tracked satellites in dB-Hz or 0 if none is tracked
+ * [0x24] - SNR MAX 1 - Max SNR of tracked satellites in dB-Hz
+ * [0x25] - SAT VIEW 1 - # satellites in view
+ * [0x26-0x2F]  RESERVED
  * [0x30-0x33]  LAT 2 - Latitude as signed 32 bit integer in degrees * 1E6 LSB first
  * [0x34-0x37] - LON 2 - Longitude as signed 32 bit integer in degrees * 1E6 LSB first
  * [0x38-0x39] - VEL 2 - Velocity as unsigned 16 bit integer in km/hr * 10 LSB first
  * [0x3A-0x3B] - HDG 2 - Heading as unsigned 16 bit integer in degrees * 10 [true] LSB first
  * [0x3C-0x3F]  ALT 2  Altitude as signed 32-bit integer in cm LSB first
  * [0x40]  SAT 2  # satellites visible or 0 if no fix
+ * [0x41-0x42] - HDOP 2 - Horizontal dilution of precision as unsigned 16 bit integer * 100 LSB first
+ * [0x43] - SNR MEAN 2 - Mean SNR of tracked satellites in dB-Hz or 0 if none is tracked
+ * [0x44] - SNR MAX 2 - Max SNR of tracked satellites in dB-Hz
+ * [0x45] - SAT VIEW 2 - # satellites in view
+ * [0x46-0x4F] - RESERVED
+ * [0x50-0x53] - UART RX CHARS 1 - Characters received by GPS 1 UART as unsigned 32 bit integer LSB first
+ * [0x54-0x57] - UART RX MESSAGES 1 - Messages completed by GPS 1 UART as unsigned 32 bit integer LSB first
+ * [0x58-0x59] - UART SKIPPED CHARS 1 - Characters outside of messages as unsigned 16 bit integer LSB first
+ * [0x5A-0x5B] - UART DROPPED TOO LONG 1 - Messages dropped as too long as unsigned 16 bit integer LSB first
+ * [0x5C-0x5D] - UART DROPPED CHARS FULL 1 - Messages dropped for full character buffer as unsigned 16 bit integer LSB first
+ * [0x5E-0x5F] - UART DROPPED MESSAGES FULL 1 - Messages dropped for full message buffer as unsigned 16 bit integer LSB first
+ * [0x60-0x61] - UART OVERRUN 1 - Receive overrun errors as unsigned 16 bit integer LSB first
+ * [0x62-0x63] - UART FRAMING 1 - Receive framing errors as unsigned 16 bit integer LSB first
+ * [0x64-0x65] - UART TX REJECTED 1 - Writes rejected for full write buffer as unsigned 16 bit integer LSB first
+ * [0x66-0x67] - UART REJECTED 1 - Messages rejected by GPS 1 parser for wrong checksum or framing as unsigned 16 bit integer LSB first
+ * [0x68-0x8F] - UART LATENCY 1 - Messages by time from '$' to main loop release, 20 buckets as unsigned 16 bit
+ *               integers LSB first, bucket 0 is below 64 us, bucket N is [2^(N+5), 2^(N+6)) us, last one takes the rest
+ * [0x90-0xCF] - UART 2 - GPS 2 UART, same layout as UART 1
+ * All UART counters count since start and wrap around
  *
  * Register map [VERSION_MAJOR = 1]:
  * [0x00] - WHO_AM_I - always returns the I2C slave address
@@ -181,6 +204,12 @@ void submitI2CData(uint32_t index, GpsData *data)
     memcpy(ptr + REG_HDG_0, data16.bytes, sizeof(data16.bytes));
     // Satellites update
     ptr[REG_SAT] = data->gpggaData.numberOfSattelitesInUse;
+    // Fix quality update
+    data16.hword = data->gpgsaData.hdop;
+    memcpy(ptr + REG_HDOP_0, data16.bytes, sizeof(data16.bytes));
+    ptr[REG_SNR_MEAN] = data->satellites.meanSnrDbHz;
+    ptr[REG_SNR_MAX] = data->satellites.maxSnrDbHz;
+    ptr[REG_SAT_VIEW] = data->satellites.satellitesInViewCount;
     // Data is available
     i2cData.regs[REG_DATA_AVAILABLE] = 1U;
     MAP_I2CSlaveIntEnableEx(I2C_MODULE, I2C_SLAVE_INT_DATA);
@@ -205,6 +234,59 @@ void submitI2CTelemetry(Telemetry *telemetry)
     MAP_I2CSlaveIntEnableEx(I2C_MODULE, I2C_SLAVE_INT_DATA);
 }
 
+void submitI2CUartHealth(uint32_t index, UartHealth *health, uint32_t rejectedMessagesCount)
+{
+    union
+    {
+        uint8_t bytes[4];
+        uint32_t word;
+    } data32;
+    union
+    {
+        uint8_t bytes[2];
+        uint16_t hword;
+    } data16;
+    // Find the correct location
+    uint8_t *ptr;
+    if (index == 0)
+        ptr = &i2cData.regs[REG_UART_BANK_1];
+    else
+        ptr = &i2cData.regs[REG_UART_BANK_2];
+    // Mask I2C interrupts while we update
+    MAP_I2CSlaveIntDisable(I2C_MODULE);
+    // Received data update
+    data32.word = health->receivedCharsCount;
+    memcpy(ptr + REG_UART_RX_CHARS_0, data32.bytes, sizeof(data32.bytes));
+    data32.word = health->receivedMessagesCount;
+    memcpy(ptr + REG_UART_RX_MESSAGES_0, data32.bytes, sizeof(data32.bytes));
+    data16.hword = (uint16_t)health->skippedCharsCount;
+    memcpy(ptr + REG_UART_SKIPPED_CHARS_0, data16.bytes, sizeof(data16.bytes));
+    // Dropped messages update
+    data16.hword = (uint16_t)health->droppedMessagesCount[UDR_TOO_LONG];
+    memcpy(ptr + REG_UART_DROPPED_TOO_LONG_0, data16.bytes, sizeof(data16.bytes));
+    data16.hword = (uint16_t)health->droppedMessagesCount[UDR_CHARACTERS_FULL];
+    memcpy(ptr + REG_UART_DROPPED_CHARS_FULL_0, data16.bytes, sizeof(data16.bytes));
+    data16.hword = (uint16_t)health->droppedMessagesCount[UDR_MESSAGES_FULL];
+    memcpy(ptr + REG_UART_DROPPED_MESSAGES_FULL_0, data16.bytes, sizeof(data16.bytes));
+    // Errors update
+    data16.hword = (uint16_t)health->overrunErrorsCount;
+    memcpy(ptr + REG_UART_OVERRUN_0, data16.bytes, sizeof(data16.bytes));
+    data16.hword = (uint16_t)health->framingErrorsCount;
+    memcpy(ptr + REG_UART_FRAMING_0, data16.bytes, sizeof(data16.bytes));
+    data16.hword = (uint16_t)health->rejectedWritesCount;
+    memcpy(ptr + REG_UART_TX_REJECTED_0, data16.bytes, sizeof(data16.bytes));
+    data16.hword = (uint16_t)rejectedMessagesCount;
+    memcpy(ptr + REG_UART_REJECTED_0, data16.bytes, sizeof(data16.bytes));
+    // Latency histogram update
+    for (uint32_t i = 0; i < UART_LATENCY_HISTOGRAM_LEN; ++i)
+    {
+        data16.hword = (uint16_t)health->latencyHistogram[i];
+        memcpy(ptr + REG_UART_LATENCY + i * sizeof(data16.bytes), data16.bytes, sizeof(data16.bytes));
+    }
+    // Restore interrupts
+    MAP_I2CSlaveIntEnableEx(I2C_MODULE, I2C_SLAVE_INT_DATA);
+}
+
 void initializeI2C(void)
 {
     // Peripheral enable: the I/O port and the I2C module
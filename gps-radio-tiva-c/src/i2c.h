@@ -3,6 +3,7 @@
 
 #include "nmea_messages.h"
 #include "telemetry.h"
+#include "uart.h"
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -11,7 +12,7 @@
 // Our software version, major (API compatible)
 #define SW_VERSION_MAJOR 2
 // Our software version, minor (revision)
-#define SW_VERSION_MINOR 2
+#define SW_VERSION_MINOR 4
 
 // I2C module to use
 // NOTE If I2C_MODULE is changed, check initializeI2C to update pin mappings/clocks!
@@ -50,11 +51,45 @@
 #define REG_ALT_2 0x0E
 #define REG_ALT_3 0x0F
 #define REG_SAT 0x10
+#define REG_HDOP_0 0x11
+#define REG_HDOP_1 0x12
+#define REG_SNR_MEAN 0x13
+#define REG_SNR_MAX 0x14
+#define REG_SAT_VIEW 0x15
+#define REG_UART_RX_CHARS_0 0x00
+#define REG_UART_RX_CHARS_1 0x01
+#define REG_UART_RX_CHARS_2 0x02
+#define REG_UART_RX_CHARS_3 0x03
+#define REG_UART_RX_MESSAGES_0 0x04
+#define REG_UART_RX_MESSAGES_1 0x05
+#define REG_UART_RX_MESSAGES_2 0x06
+#define REG_UART_RX_MESSAGES_3 0x07
+#define REG_UART_SKIPPED_CHARS_0 0x08
+#define REG_UART_SKIPPED_CHARS_1 0x09
+#define REG_UART_DROPPED_TOO_LONG_0 0x0A
+#define REG_UART_DROPPED_TOO_LONG_1 0x0B
+#define REG_UART_DROPPED_CHARS_FULL_0 0x0C
+#define REG_UART_DROPPED_CHARS_FULL_1 0x0D
+#define REG_UART_DROPPED_MESSAGES_FULL_0 0x0E
+#define REG_UART_DROPPED_MESSAGES_FULL_1 0x0F
+#define REG_UART_OVERRUN_0 0x10
+#define REG_UART_OVERRUN_1 0x11
+#define REG_UART_FRAMING_0 0x12
+#define REG_UART_FRAMING_1 0x13
+#define REG_UART_TX_REJECTED_0 0x14
+#define REG_UART_TX_REJECTED_1 0x15
+#define REG_UART_REJECTED_0 0x16
+#define REG_UART_REJECTED_1 0x17
+// UART_LATENCY_HISTOGRAM_LEN 16 bit buckets
+#define REG_UART_LATENCY 0x18
 // 2 GPS data sets
 #define REG_BANK_1 0x10
 #define REG_BANK_2 0x30
+// 2 GPS UART health sets
+#define REG_UART_BANK_1 0x50
+#define REG_UART_BANK_2 0x90
 // Must be last register address + 1
-#define I2C_NUM_REGS 0x41
+#define I2C_NUM_REGS 0xD0
 
 // Returns true if the I2C communications with the Raspberry PI are running
 bool i2cCommRunning(void);
@@ -65,3 +100,7 @@ void initializeI2C(void);
 void submitI2CData(uint32_t index, GpsData *data);
 // Submits voltage and temperature data to the I2C subsystem
 void submitI2CTelemetry(Telemetry *telemetry);
+// Submits UART health counters to the I2C subsystem
+// index is the GPS (0 = Venus, 1 = Copernicus) UART to update
+// rejectedMessagesCount is counted by the protocol parser of that GPS
+void submitI2CUartHealth(uint32_t index, UartHealth *health, uint32_t rejectedMessagesCount);
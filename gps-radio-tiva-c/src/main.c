@@ -7,6 +7,9 @@
 #include "aprs_board.h"
 #include "i2c.h"
 #include "eeprom.h"
+#include "nmea_stream.h"
+#include "venus_binary.h"
+#include "tsip.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -17,8 +20,30 @@
 // Reduce stack usage by main() and get a "free" zero initialization!
 static GpsData venusGpsData;
 static GpsData copernicusGpsData;
-static Message venusGpsMessage;
-static Message copernicusGpsMessage;
+#ifdef VENUS_BINARY_PROTOCOL
+    // Venus binary frames are parsed in UART interrupt as they arrive
+    static VenusBinaryParser venusBinaryParser;
+    static uint32_t nextVenusConfigurationTime;
+#endif
+#ifdef COPERNICUS_TSIP_PROTOCOL
+    // Copernicus TSIP packets are parsed in UART interrupt as they arrive
+    static TsipParser copernicusTsipParser;
+    static uint32_t nextCopernicusConfigurationTime;
+#endif
+#ifdef NMEA_STREAMING_PARSER
+    // NMEA sentences are parsed in UART interrupts as they arrive
+#ifndef VENUS_BINARY_PROTOCOL
+    static NmeaStreamParser venusNmeaStreamParser;
+#endif
+#ifndef COPERNICUS_TSIP_PROTOCOL
+    static NmeaStreamParser copernicusNmeaStreamParser;
+#endif
+#else
+#if !defined(VENUS_BINARY_PROTOCOL) || !defined(COPERNICUS_TSIP_PROTOCOL)
+    // NMEA messages rejected because of missing or wrong checksum, per channel (exposed over I2C)
+    static uint32_t rejectedNmeaMessagesCount[UART_NUMBER_OF_CHANNELS];
+#endif
+#endif
 static Telemetry telemetry;
 
 #ifdef DUMP_DATA_TO_UART0
@@ -35,6 +60,30 @@ static Telemetry telemetry;
     static uint32_t ditherCount;
 #endif
 
+#if defined(NMEA_STREAMING_PARSER) && (!defined(VENUS_BINARY_PROTOCOL) || !defined(COPERNICUS_TSIP_PROTOCOL))
+// Feeds characters received by GPS UART to its NMEA parser (UART interrupt)
+static void parseNmeaUartCharacter(void *context, uint8_t character)
+{
+    parseNmeaCharacter((NmeaStreamParser*) context, character);
+}
+#endif
+
+#ifdef VENUS_BINARY_PROTOCOL
+// Feeds bytes received by Venus UART to its binary frame parser (UART interrupt)
+static void parseVenusUartByte(void *context, uint8_t character)
+{
+    parseVenusBinaryByte((VenusBinaryParser*) context, character);
+}
+#endif
+
+#ifdef COPERNICUS_TSIP_PROTOCOL
+// Feeds bytes received by Copernicus UART to its TSIP packet parser (UART interrupt)
+static void parseCopernicusUartByte(void *context, uint8_t character)
+{
+    parseTsipByte((TsipParser*) context, character);
+}
+#endif
+
 // Initialize the board
 static inline uint32_t init(void)
 {
@@ -57,8 +106,30 @@ static inline uint32_t init(void)
     initializeI2C();
 
     // Configure UART channels
+#ifdef VENUS_BINARY_PROTOCOL
+    // Venus is switched to binary output by main loop
+    r &= initializeUartChannel(CHANNEL_VENUS_GPS, UART_1, 9600, CPU_SPEED, UART_FLAGS_RECEIVE | UART_FLAGS_SEND);
+    initializeVenusBinaryParser(&venusBinaryParser);
+    r &= setUartReadCallback(CHANNEL_VENUS_GPS, parseVenusUartByte, &venusBinaryParser);
+#else
     r &= initializeUartChannel(CHANNEL_VENUS_GPS, UART_1, 9600, CPU_SPEED, UART_FLAGS_RECEIVE);
+#endif
     r &= initializeUartChannel(CHANNEL_COPERNICUS_GPS, UART_2, 4800, CPU_SPEED, UART_FLAGS_RECEIVE | UART_FLAGS_SEND);
+#ifdef COPERNICUS_TSIP_PROTOCOL
+    // Copernicus is switched to TSIP output by main loop
+    initializeTsipParser(&copernicusTsipParser);
+    r &= setUartReadCallback(CHANNEL_COPERNICUS_GPS, parseCopernicusUartByte, &copernicusTsipParser);
+#endif
+#ifdef NMEA_STREAMING_PARSER
+#ifndef VENUS_BINARY_PROTOCOL
+    initializeNmeaStreamParser(&venusNmeaStreamParser);
+    r &= setUartReadCallback(CHANNEL_VENUS_GPS, parseNmeaUartCharacter, &venusNmeaStreamParser);
+#endif
+#ifndef COPERNICUS_TSIP_PROTOCOL
+    initializeNmeaStreamParser(&copernicusNmeaStreamParser);
+    r &= setUartReadCallback(CHANNEL_COPERNICUS_GPS, parseNmeaUartCharacter, &copernicusNmeaStreamParser);
+#endif
+#endif
 #ifdef DUMP_DATA_TO_UART0
     r &= initializeUartChannel(CHANNEL_OUTPUT, UART_0, 115200, CPU_SPEED, UART_FLAGS_SEND);
 #endif
@@ -74,11 +145,29 @@ static inline uint32_t init(void)
     return record;
 }
 
+#if defined(VENUS_BINARY_PROTOCOL) && defined(COPERNICUS_TSIP_PROTOCOL)
+// Neither GPS module sends NMEA
+#elif defined(NMEA_STREAMING_PARSER)
+// Picks up GPS module data published by UART interrupt
+static void updateGPS(uint32_t channel, NmeaStreamParser *parser, GpsData *dataOut)
+{
+    if (readNmeaStreamGpsData(parser, dataOut))
+    {
+        // Conveniently enough, the channels match the I2C indices
+        submitI2CData(channel, dataOut);
+    }
+}
+#else
 // Reads and updates GPS module data
-static void updateGPS(uint32_t channel, Message *messageIn, GpsData *dataOut)
+static void updateGPS(uint32_t channel, GpsData *dataOut)
 {
-    // If a message is available
-    if (readMessage(channel, messageIn) && messageIn->size > 6)
+    const Message* messageIn;
+    // If a message is available (parsed in place in UART buffer)
+    if (!peekMessage(channel, &messageIn))
+    {
+        return;
+    }
+    if (messageIn->size > 6)
     {
 #ifdef DUMP_DATA_TO_UART0
         // Debugging usage only
@@ -92,37 +181,111 @@ static void updateGPS(uint32_t channel, Message *messageIn, GpsData *dataOut)
         }
         writeMessage(CHANNEL_OUTPUT, messageIn);
 #endif
-        if (memcmp(messageIn->message, "$GP", 3) == 0)
+        switch (parseNmeaMessage(messageIn, dataOut))
         {
-            bool update = false;
-            if (memcmp(messageIn->message + 3, "GGA", 3) == 0)
+            case NMR_PARSED:
             {
-                // Global Positioning System fix
-                parseGpggaMessageIfValid(messageIn, dataOut);
-                update = true;
+                // The GPS can be set up to disable all the other messages in theory
+                // Conveniently enough, the channels match the I2C indices
+                submitI2CData(channel, dataOut);
+                break;
             }
-            else if (memcmp(venusGpsMessage.message + 3, "VTG", 3) == 0)
+            case NMR_REJECTED:
             {
-                // Track made good and ground speed
-                parseGpvtgMessageIfValid(messageIn, dataOut);
-                update = true;
+                ++rejectedNmeaMessagesCount[channel];
+                break;
             }
-            if (update)
+            default:
             {
-                // The GPS can be set up to disable all the other messages in theory
-                // Conveniently enough, the channels match the I2C indices
-                submitI2CData(channel, dataOut);
+                break;
             }
         }
     }
+    // Its space can be reused by UART interrupt from now on
+    releaseMessage(channel);
 }
+#endif
 
-// Sends an APRS message
-static inline uint32_t sendAPRS(uint32_t now, bool *sendVenusData)
+#ifdef VENUS_BINARY_PROTOCOL
+// Switches Venus to binary output until it confirms and picks up navigation data published by UART interrupt
+static void updateVenusGPS(uint32_t now)
+{
+    // Receiver boots with NMEA output (configuration goes to SRAM only), command is repeated in case it was lost
+    if (!venusBinaryParser.isBinaryOutputConfirmed && now >= nextVenusConfigurationTime)
+    {
+        uint8_t frame[VENUS_BINARY_OUTPUT_FRAME_LEN];
+        writeMessageBuffer(CHANNEL_VENUS_GPS, frame, createVenusBinaryOutputFrame(frame));
+        nextVenusConfigurationTime = now + VENUS_CONFIGURATION_RETRY_INTERVAL;
+    }
+    if (readVenusGpsData(&venusBinaryParser, &venusGpsData))
+    {
+        submitI2CData(CHANNEL_VENUS_GPS, &venusGpsData);
+    }
+}
+#endif
+
+#ifdef COPERNICUS_TSIP_PROTOCOL
+// Switches Copernicus to TSIP output until it reports the I/O options and picks up reports published by UART interrupt
+static void updateCopernicusGPS(uint32_t now)
+{
+    // Port configuration is kept in battery backed memory only, both commands are repeated until they are confirmed
+    if (!copernicusTsipParser.isTsipOutputConfirmed && now >= nextCopernicusConfigurationTime)
+    {
+        uint8_t packet[TSIP_IO_OPTIONS_PACKET_MAX_LEN];
+        writeString(CHANNEL_COPERNICUS_GPS, TSIP_PORT_CONFIGURATION_SENTENCE);
+        writeMessageBuffer(CHANNEL_COPERNICUS_GPS, packet, createTsipIoOptionsPacket(packet));
+        nextCopernicusConfigurationTime = now + COPERNICUS_CONFIGURATION_RETRY_INTERVAL;
+    }
+    if (readTsipGpsData(&copernicusTsipParser, &copernicusGpsData))
+    {
+        submitI2CData(CHANNEL_COPERNICUS_GPS, &copernicusGpsData);
+    }
+}
+#endif
+
+// Returns messages rejected by the protocol parser of the GPS channel
+static uint32_t getRejectedMessagesCount(uint8_t channel)
+{
+    if (channel == CHANNEL_VENUS_GPS)
+    {
+#if defined(VENUS_BINARY_PROTOCOL)
+        return venusBinaryParser.rejectedCount;
+#elif defined(NMEA_STREAMING_PARSER)
+        return venusNmeaStreamParser.rejectedCount;
+#else
+        return rejectedNmeaMessagesCount[CHANNEL_VENUS_GPS];
+#endif
+    }
+    else
+    {
+#if defined(COPERNICUS_TSIP_PROTOCOL)
+        return copernicusTsipParser.rejectedCount;
+#elif defined(NMEA_STREAMING_PARSER)
+        return copernicusNmeaStreamParser.rejectedCount;
+#else
+        return rejectedNmeaMessagesCount[CHANNEL_COPERNICUS_GPS];
+#endif
+    }
+}
+
+// Copies UART health counters of both GPS channels to I2C registers
+static void updateUartHealth(void)
+{
+    UartHealth health;
+    // Conveniently enough, the channels match the I2C indices
+    if (getUartHealth(CHANNEL_VENUS_GPS, &health))
+    {
+        submitI2CUartHealth(CHANNEL_VENUS_GPS, &health, getRejectedMessagesCount(CHANNEL_VENUS_GPS));
+    }
+    if (getUartHealth(CHANNEL_COPERNICUS_GPS, &health))
+    {
+        submitI2CUartHealth(CHANNEL_COPERNICUS_GPS, &health, getRejectedMessagesCount(CHANNEL_COPERNICUS_GPS));
+    }
+}
+
+// Encodes an APRS message with the latest GPS data without keying up
+static inline bool prepareAPRS(bool shouldSendVenusDataToAprs, uint32_t *alt)
 {
-    uint32_t dither, alt = 0U;
-    const bool shouldSendVenusDataToAprs = *sendVenusData;
-    
     // Fetch telemetry data
     getTelemetry(&telemetry);
 #ifdef DUMP_DATA_TO_UART0
@@ -133,20 +296,47 @@ static inline uint32_t sendAPRS(uint32_t now, bool *sendVenusData)
     // Update I2C registers
     submitI2CTelemetry(&telemetry);
     
-    if (shouldSendVenusDataToAprs && venusGpsData.gpggaData.latitude.isValid && venusGpsData.gpggaData.longitude.isValid)
+    AprsMessage messages[APRS_BURST_MAX_MESSAGES];
+    uint8_t messagesCount = 0;
+    const bool isVenusDataValid = venusGpsData.gpggaData.latitude.isValid && venusGpsData.gpggaData.longitude.isValid;
+#ifdef APRS_BURST_MODE
+    // both fixes go out as consecutive frames under a single key up
+    const bool isCopernicusDataValid = copernicusGpsData.gpggaData.latitude.isValid && copernicusGpsData.gpggaData.longitude.isValid;
+    if (isVenusDataValid)
+    {
+        messages[messagesCount].gpsDataSource = GPS_ID_VENUS;
+        messages[messagesCount].pGpsData = &venusGpsData;
+        ++messagesCount;
+    }
+    if (isCopernicusDataValid || messagesCount == 0)
+#else
+    if (shouldSendVenusDataToAprs && isVenusDataValid)
     {
         // venus data
-        alt = venusGpsData.gpggaData.altitudeMslMeters;
-        sendAprsMessage(GPS_ID_VENUS, &venusGpsData, &telemetry);
+        messages[messagesCount].gpsDataSource = GPS_ID_VENUS;
+        messages[messagesCount].pGpsData = &venusGpsData;
+        ++messagesCount;
     }
     else
+#endif
     {
         // higher chance that copernicus will work more reliably
         // so we will use it as a default fallback
-        alt = copernicusGpsData.gpggaData.altitudeMslMeters;
-        sendAprsMessage(GPS_ID_COPERNICUS, &copernicusGpsData, &telemetry);
+        messages[messagesCount].gpsDataSource = GPS_ID_COPERNICUS;
+        messages[messagesCount].pGpsData = &copernicusGpsData;
+        ++messagesCount;
     }
-    *sendVenusData = !shouldSendVenusDataToAprs;
+    // altitude of the first position sent decides the radio cadence
+    *alt = messages[0].pGpsData->gpggaData.altitudeMslMeters;
+    return prepareAprsMessage(messages, messagesCount, &telemetry);
+}
+
+// Sends the prepared APRS message
+static inline uint32_t transmitAPRS(uint32_t now, uint32_t alt)
+{
+    uint32_t dither;
+
+    transmitAprsMessage();
     
 #if defined(RADIO_MCU_MESSAGE_DITHER) && (RADIO_MCU_MESSAGE_DITHER > 0)
     {
@@ -203,8 +393,8 @@ static inline uint32_t writeEEPROM(uint32_t record)
 
 int main()
 {
-    bool shouldSendVenusDataToAprs = true;
-    uint32_t currentTime, nextRadioSendTime = 5U;
+    bool shouldSendVenusDataToAprs = true, isAprsMessagePrepared = false;
+    uint32_t currentTime, nextRadioSendTime = 5U, uartHealthTime = 0U, aprsAltitude = 0U;
     // Initialize board
     uint32_t record = init();
     // Start the watchdog
@@ -212,20 +402,45 @@ int main()
     while (true)
     {
         // GPS data update
-        updateGPS(CHANNEL_VENUS_GPS, &venusGpsMessage, &venusGpsData);
-        updateGPS(CHANNEL_COPERNICUS_GPS, &copernicusGpsMessage, &copernicusGpsData);
+#ifdef VENUS_BINARY_PROTOCOL
+        updateVenusGPS(getSecondsSinceStart());
+#elif defined(NMEA_STREAMING_PARSER)
+        updateGPS(CHANNEL_VENUS_GPS, &venusNmeaStreamParser, &venusGpsData);
+#else
+        updateGPS(CHANNEL_VENUS_GPS, &venusGpsData);
+#endif
+#ifdef COPERNICUS_TSIP_PROTOCOL
+        updateCopernicusGPS(getSecondsSinceStart());
+#elif defined(NMEA_STREAMING_PARSER)
+        updateGPS(CHANNEL_COPERNICUS_GPS, &copernicusNmeaStreamParser, &copernicusGpsData);
+#else
+        updateGPS(CHANNEL_COPERNICUS_GPS, &copernicusGpsData);
+#endif
         
         currentTime = getSecondsSinceStart();
+        // UART diagnostics go to I2C once a second
+        if (currentTime != uartHealthTime)
+        {
+            updateUartHealth();
+            uartHealthTime = currentTime;
+        }
         // If user button 1 is down, send APRS message "now"
         if (isUserButton1())
         {
             nextRadioSendTime = currentTime + 1U;
         }
 
+        // Encode message ahead of its time slot, retried until it fits into a free buffer
+        if (!isAprsMessagePrepared && currentTime + RADIO_MCU_MESSAGE_PREPARE_AHEAD >= nextRadioSendTime)
+        {
+            isAprsMessagePrepared = prepareAPRS(shouldSendVenusDataToAprs, &aprsAltitude);
+        }
         if (currentTime >= nextRadioSendTime)
         {
             // Send message
-            nextRadioSendTime = sendAPRS(currentTime, &shouldSendVenusDataToAprs);
+            nextRadioSendTime = transmitAPRS(currentTime, aprsAltitude);
+            shouldSendVenusDataToAprs = !shouldSendVenusDataToAprs;
+            isAprsMessagePrepared = false;
             // EEPROM
 #ifdef EEPROM_ENABLED
             record = writeEEPROM(record);
@@ -1,12 +1,68 @@
 #include "nmea_messages_impl.h"
 
-#include <math.h>
+#include <string.h>
+
+static const NmeaFieldSchema GPGGA_SCHEMA[] =
+{
+    NMEA_GPGGA_FIELDS(NMEA_FIELD_SCHEMA)
+};
+
+static const NmeaFieldSchema GPVTG_SCHEMA[] =
+{
+    NMEA_GPVTG_FIELDS(NMEA_FIELD_SCHEMA)
+};
+
+static const NmeaFieldSchema GPRMC_SCHEMA[] =
+{
+    NMEA_GPRMC_FIELDS(NMEA_FIELD_SCHEMA)
+};
+
+static const NmeaFieldSchema GPZDA_SCHEMA[] =
+{
+    NMEA_GPZDA_FIELDS(NMEA_FIELD_SCHEMA)
+};
+
+static const NmeaFieldSchema GPGSA_SCHEMA[] =
+{
+    NMEA_GPGSA_FIELDS(NMEA_FIELD_SCHEMA)
+};
+
+static const NmeaFieldSchema GPGSV_SCHEMA[] =
+{
+    NMEA_GPGSV_FIELDS(NMEA_FIELD_SCHEMA)
+};
+
+// GPGSV assembly keeps a bit per talker in uint8_t mask
+static const uint16_t NMEA_GNSS_TALKERS[] =
+{
+    NMEA_TALKER_ID('G', 'P'), // GPS
+    NMEA_TALKER_ID('G', 'N'), // multiple constellations
+    NMEA_TALKER_ID('G', 'L'), // GLONASS
+    NMEA_TALKER_ID('G', 'A'), // Galileo
+    NMEA_TALKER_ID('G', 'B'), // BeiDou
+    NMEA_TALKER_ID('B', 'D'), // BeiDou
+};
+
+static const NmeaSentenceParser NMEA_SENTENCE_PARSERS[] =
+{
+    { NMEA_SENTENCE_TYPE_ID('G', 'G', 'A'), parseGpggaFields, GPGGA_SCHEMA, NMEA_SCHEMA_LEN(GPGGA_SCHEMA), NMEA_SCHEMA_LEN(GPGGA_SCHEMA), applyGpggaFields },
+    { NMEA_SENTENCE_TYPE_ID('V', 'T', 'G'), parseGpvtgFields, GPVTG_SCHEMA, NMEA_SCHEMA_LEN(GPVTG_SCHEMA), NMEA_SCHEMA_LEN(GPVTG_SCHEMA), applyGpvtgFields },
+    { NMEA_SENTENCE_TYPE_ID('R', 'M', 'C'), parseGprmcFields, GPRMC_SCHEMA, NMEA_SCHEMA_LEN(GPRMC_SCHEMA), NMEA_SCHEMA_LEN(GPRMC_SCHEMA), applyGprmcFields },
+    { NMEA_SENTENCE_TYPE_ID('Z', 'D', 'A'), parseGpzdaFields, GPZDA_SCHEMA, NMEA_SCHEMA_LEN(GPZDA_SCHEMA), NMEA_SCHEMA_LEN(GPZDA_SCHEMA), applyGpzdaFields },
+    { NMEA_SENTENCE_TYPE_ID('G', 'S', 'A'), parseGpgsaFields, GPGSA_SCHEMA, NMEA_SCHEMA_LEN(GPGSA_SCHEMA), NMEA_SCHEMA_LEN(GPGSA_SCHEMA), applyGpgsaFields },
+    { NMEA_SENTENCE_TYPE_ID('G', 'S', 'V'), parseGpgsvFields, GPGSV_SCHEMA, NMEA_SCHEMA_LEN(GPGSV_SCHEMA), NMEA_GPGSV_REQUIRED_FIELDS_COUNT, applyGpgsvFields },
+};
 
 int32_t angularCoordinateToInt32Degrees(AngularCoordinate coord)
 {
     if (coord.isValid)
     {
-        return (int32_t) (1000000.0f * (coord.degrees + (float) coord.minutes / (1000000.0f * 60.0f)));
+        // minutes are W2F6 so 60 of their units make a micro degree, integer math keeps all 9 digits exact
+
+        const int32_t microDegrees = (int32_t) coord.degrees * MICRO_DEGREES_PER_DEGREE +
+            (int32_t) ((coord.minutes + MINUTES_UNITS_PER_MICRO_DEGREE / 2) / MINUTES_UNITS_PER_MICRO_DEGREE);
+
+        return coord.hemisphere == H_SOUTH || coord.hemisphere == H_WEST ? -microDegrees : microDegrees;
     }
     else
     {
@@ -14,52 +70,402 @@ int32_t angularCoordinateToInt32Degrees(AngularCoordinate coord)
     }
 }
 
-void parseGpggaMessageIfValid(const Message* pGpggaMessage, GpsData* pResult)
+void applyGpggaFields(const NmeaSentenceFields* pFields, uint16_t talkerId, GpsData* pResult)
 {
-    if (!pGpggaMessage || !pResult)
+    const GpggaData* const pGpggaData = &pFields->gpggaData;
+
+    if ((pGpggaData->fixType == GPSFT_GPS || pGpggaData->fixType == GPSFT_DGPS || pGpggaData->fixType == GPSFT_MANUAL_INPUT_MODE) &&
+        pGpggaData->latitude.isValid && pGpggaData->longitude.isValid)
+    {
+        pResult->gpggaData = *pGpggaData;
+        pResult->isValid = true;
+    }
+}
+
+void applyGpvtgFields(const NmeaSentenceFields* pFields, uint16_t talkerId, GpsData* pResult)
+{
+    pResult->gpvtgData = pFields->gpvtgData;
+}
+
+void applyGprmcFields(const NmeaSentenceFields* pFields, uint16_t talkerId, GpsData* pResult)
+{
+    const GprmcData* const pGprmcData = &pFields->gprmcData;
+
+    // void status means receiver has no fix and the rest of the fields are stale
+
+    if (pGprmcData->status != GPRMCS_ACTIVE || !pGprmcData->latitude.isValid || !pGprmcData->longitude.isValid)
     {
         return;
     }
 
-    uint8_t gpsQuality;
-    GpggaData gpggaData;
-    NmeaParsingContext parsingContext = { pGpggaMessage, 0 };
+    pResult->gpggaData.utcTime = pGprmcData->utcTime;
+    pResult->gpggaData.latitude = pGprmcData->latitude;
+    pResult->gpggaData.longitude = pGprmcData->longitude;
+    pResult->gpvtgData.trueCourseDegrees = pGprmcData->trueCourseDegrees;
+    pResult->utcDate = pGprmcData->utcDate;
+
+    const uint32_t speedKph = ((uint32_t) pGprmcData->speedKnots * NMEA_KNOTS_TO_KPH_NUMERATOR + NMEA_KNOTS_TO_KPH_DENOMINATOR / 2) / NMEA_KNOTS_TO_KPH_DENOMINATOR;
+    pResult->gpvtgData.speedKph = speedKph > 65535 ? 65535 : (fixedPointW3F1_t) speedKph;
 
-    // header
-    PARSE_DUMMY_TOKEN(parsingContext); // GPGGA header
-    PARSE_GPS_TIME(parsingContext, gpggaData.utcTime);
-    PARSE_LATITUDE(parsingContext, gpggaData.latitude);
-    PARSE_LONGITUDE(parsingContext, gpggaData.longitude);
-    PARSE_UINT8_DEFAULT_TO_0(parsingContext, gpsQuality);
-    PARSE_UINT8_DEFAULT_TO_0(parsingContext, gpggaData.numberOfSattelitesInUse);
-    PARSE_DUMMY_TOKEN(parsingContext); // horizontal dilution of position
-    PARSE_FIXED_POINT_UINT32_F1_DEFAULT_TO_0(parsingContext, gpggaData.altitudeMslMeters);
-    // rest of the fields are ignored
+    pResult->isValid = true;
+}
+
+void applyGpzdaFields(const NmeaSentenceFields* pFields, uint16_t talkerId, GpsData* pResult)
+{
+    const GpzdaData* const pGpzdaData = &pFields->gpzdaData;
 
-    gpggaData.fixType = (GPS_FIX_TYPE) gpsQuality;
+    // fields are empty until receiver gets time from satellites
 
-    if ((gpggaData.fixType == GPSFT_GPS || gpggaData.fixType == GPSFT_DGPS || gpggaData.fixType == GPSFT_MANUAL_INPUT_MODE) &&
-        gpggaData.latitude.isValid && gpggaData.longitude.isValid)
+    if (!pGpzdaData->utcTime.isValid ||
+        pGpzdaData->day < 1 || pGpzdaData->day > 31 ||
+        pGpzdaData->month < 1 || pGpzdaData->month > 12 ||
+        pGpzdaData->year < NMEA_FIRST_YEAR)
     {
-        pResult->gpggaData = gpggaData;
-        pResult->isValid = true;
+        return;
+    }
+
+    pResult->gpggaData.utcTime = pGpzdaData->utcTime;
+    pResult->utcDate.day = pGpzdaData->day;
+    pResult->utcDate.month = pGpzdaData->month;
+    pResult->utcDate.year = pGpzdaData->year;
+    pResult->utcDate.isValid = true;
+}
+
+void applyGpgsaFields(const NmeaSentenceFields* pFields, uint16_t talkerId, GpsData* pResult)
+{
+    const GpgsaData* const pGpgsaFields = &pFields->gpgsaData;
+    GpgsaData* const pGpgsaData = &pResult->gpgsaData;
+
+    pGpgsaData->fixMode = pGpgsaFields->fixMode;
+    pGpgsaData->pdop = pGpgsaFields->pdop;
+    pGpgsaData->hdop = pGpgsaFields->hdop;
+    pGpgsaData->vdop = pGpgsaFields->vdop;
+
+    if (pResult->lastSentenceTypeId != NMEA_SENTENCE_TYPE_ID('G', 'S', 'A'))
+    {
+        // first sentence of the run replaces used satellites of the previous fix
+
+        memset(pGpgsaData->usedPrns, 0, sizeof(pGpgsaData->usedPrns));
+        memcpy(pGpgsaData->usedPrns, pGpgsaFields->usedPrns, GPGSA_MAX_USED_SATELLITES_COUNT);
+    }
+    else
+    {
+        // the next ones are appended after the last used satellite, what doesn't fit is dropped
+
+        uint8_t usedIdx = 0;
+
+        for (uint8_t i = 0; i < GPS_MAX_USED_SATELLITES_COUNT; ++i)
+        {
+            if (pGpgsaData->usedPrns[i] != 0)
+            {
+                usedIdx = i + 1;
+            }
+        }
+
+        for (uint8_t i = 0; i < GPGSA_MAX_USED_SATELLITES_COUNT && usedIdx < GPS_MAX_USED_SATELLITES_COUNT; ++i)
+        {
+            if (pGpgsaFields->usedPrns[i] != 0)
+            {
+                pGpgsaData->usedPrns[usedIdx++] = pGpgsaFields->usedPrns[i];
+            }
+        }
+    }
+
+    updateSatellitesSummary(pResult);
+}
+
+void applyGpgsvFields(const NmeaSentenceFields* pFields, uint16_t talkerId, GpsData* pResult)
+{
+    const GpgsvData* const pGpgsvData = &pFields->gpgsvData;
+    GpsSatellites* const pSatellites = &pResult->satellites;
+    const uint8_t talkerIdx = gnssTalkerIdx(talkerId);
+
+    if (talkerIdx == NMEA_UNKNOWN_TALKER_IDX || pGpgsvData->messageNumber == 0 || pGpgsvData->messageNumber > pGpgsvData->messagesCount)
+    {
+        return;
+    }
+
+    const uint8_t talkerMask = 1 << talkerIdx;
+
+    if (pGpgsvData->messageNumber == 1)
+    {
+        // talker which has already completed its sequence starts the next cycle
+
+        if (pSatellites->gpgsvCycleTalkersMask & talkerMask)
+        {
+            pSatellites->gpgsvCycleTalkersMask = 0;
+            pSatellites->gpgsvCycleSatellitesCount = 0;
+            pSatellites->gpgsvCycleInViewCount = 0;
+        }
+
+        pSatellites->gpgsvTalkerIdx = talkerIdx;
+    }
+    else if (pGpgsvData->messageNumber != pSatellites->nextGpgsvMessageNumber || talkerIdx != pSatellites->gpgsvTalkerIdx)
+    {
+        // parts have to come in order, sequence with a lost part is dropped until the next first part
+
+        pSatellites->nextGpgsvMessageNumber = 0;
+        return;
+    }
+
+    // parts past the table still count for the sequence, indices of message numbers above 64 don't fit in a byte
+
+    const uint16_t firstIdx = (uint16_t) (pGpgsvData->messageNumber - 1) * GPGSV_SATELLITES_PER_MESSAGE;
+
+    for (uint8_t i = 0; i < GPGSV_SATELLITES_PER_MESSAGE; ++i)
+    {
+        const uint16_t idx = firstIdx + i;
+        const uint16_t tableIdx = pSatellites->gpgsvCycleSatellitesCount + idx;
+
+        if (idx >= pGpgsvData->satellitesInViewCount || tableIdx >= GPS_MAX_SATELLITES_COUNT)
+        {
+            break;
+        }
+
+        pSatellites->satellites[tableIdx] = pGpgsvData->satellites[i];
+    }
+
+    if (pGpgsvData->messageNumber < pGpgsvData->messagesCount)
+    {
+        pSatellites->nextGpgsvMessageNumber = pGpgsvData->messageNumber + 1;
+        return;
+    }
+
+    const uint8_t freeEntriesCount = GPS_MAX_SATELLITES_COUNT - pSatellites->gpgsvCycleSatellitesCount;
+
+    pSatellites->nextGpgsvMessageNumber = 0;
+    pSatellites->gpgsvCycleTalkersMask |= talkerMask;
+    pSatellites->gpgsvCycleSatellitesCount += pGpgsvData->satellitesInViewCount < freeEntriesCount ? pGpgsvData->satellitesInViewCount : freeEntriesCount;
+    pSatellites->gpgsvCycleInViewCount += pGpgsvData->satellitesInViewCount;
+
+    pSatellites->satellitesInViewCount = pSatellites->gpgsvCycleInViewCount;
+    pSatellites->satellitesCount = pSatellites->gpgsvCycleSatellitesCount;
+
+    updateSatellitesSummary(pResult);
+}
+
+void updateSatellitesSummary(GpsData* pGpsData)
+{
+    GpsSatellites* const pSatellites = &pGpsData->satellites;
+
+    uint16_t snrSum = 0;
+
+    pSatellites->trackedSatellitesCount = 0;
+    pSatellites->maxSnrDbHz = 0;
+
+    for (uint8_t i = 0; i < pSatellites->satellitesCount; ++i)
+    {
+        GpsSatellite* const pSatellite = &pSatellites->satellites[i];
+
+        pSatellite->isUsed = false;
+        for (uint8_t j = 0; j < GPS_MAX_USED_SATELLITES_COUNT; ++j)
+        {
+            if (pSatellite->prn != 0 && pGpsData->gpgsaData.usedPrns[j] == pSatellite->prn)
+            {
+                pSatellite->isUsed = true;
+                break;
+            }
+        }
+
+        if (pSatellite->snrDbHz != 0)
+        {
+            snrSum += pSatellite->snrDbHz;
+            ++pSatellites->trackedSatellitesCount;
+
+            if (pSatellite->snrDbHz > pSatellites->maxSnrDbHz)
+            {
+                pSatellites->maxSnrDbHz = pSatellite->snrDbHz;
+            }
+        }
+    }
+
+    pSatellites->meanSnrDbHz = pSatellites->trackedSatellitesCount ? (uint8_t) (snrSum / pSatellites->trackedSatellitesCount) : 0;
+}
+
+void parseGpggaFields(const NmeaTokens* pTokens, GpsData* pResult)
+{
+    NmeaSentenceFields fields;
+
+    if (parseSchemaFields(pTokens, GPGGA_SCHEMA, NMEA_SCHEMA_LEN(GPGGA_SCHEMA), &fields))
+    {
+        applyGpggaFields(&fields, tokensTalkerId(pTokens), pResult);
+    }
+}
+
+void parseGpvtgFields(const NmeaTokens* pTokens, GpsData* pResult)
+{
+    NmeaSentenceFields fields;
+
+    if (parseSchemaFields(pTokens, GPVTG_SCHEMA, NMEA_SCHEMA_LEN(GPVTG_SCHEMA), &fields))
+    {
+        applyGpvtgFields(&fields, tokensTalkerId(pTokens), pResult);
+    }
+}
+
+void parseGprmcFields(const NmeaTokens* pTokens, GpsData* pResult)
+{
+    NmeaSentenceFields fields;
+
+    if (parseSchemaFields(pTokens, GPRMC_SCHEMA, NMEA_SCHEMA_LEN(GPRMC_SCHEMA), &fields))
+    {
+        applyGprmcFields(&fields, tokensTalkerId(pTokens), pResult);
+    }
+}
+
+void parseGpzdaFields(const NmeaTokens* pTokens, GpsData* pResult)
+{
+    NmeaSentenceFields fields;
+
+    if (parseSchemaFields(pTokens, GPZDA_SCHEMA, NMEA_SCHEMA_LEN(GPZDA_SCHEMA), &fields))
+    {
+        applyGpzdaFields(&fields, tokensTalkerId(pTokens), pResult);
+    }
+}
+
+void parseGpgsaFields(const NmeaTokens* pTokens, GpsData* pResult)
+{
+    NmeaSentenceFields fields;
+
+    if (parseSchemaFields(pTokens, GPGSA_SCHEMA, NMEA_SCHEMA_LEN(GPGSA_SCHEMA), &fields))
+    {
+        applyGpgsaFields(&fields, tokensTalkerId(pTokens), pResult);
+    }
+}
+
+void parseGpgsvFields(const NmeaTokens* pTokens, GpsData* pResult)
+{
+    NmeaSentenceFields fields;
+    memset(&fields, 0, sizeof(fields));
+
+    const uint8_t schemaLen = presentSchemaLen(pTokens, GPGSV_SCHEMA, NMEA_SCHEMA_LEN(GPGSV_SCHEMA));
+
+    if (schemaLen >= NMEA_GPGSV_REQUIRED_FIELDS_COUNT && parseSchemaFields(pTokens, GPGSV_SCHEMA, schemaLen, &fields))
+    {
+        applyGpgsvFields(&fields, tokensTalkerId(pTokens), pResult);
+    }
+}
+
+bool parseGpggaMessageIfValid(const Message* pGpggaMessage, GpsData* pResult)
+{
+    NmeaTokens tokens;
+
+    // fields are located and checksum is calculated in one pass, corrupted message costs just that pass
+
+    if (!pGpggaMessage || !pResult || !tokenizeMessage(pGpggaMessage, &tokens) || !isChecksumValid(&tokens))
+    {
+        return false;
+    }
+
+    parseGpggaFields(&tokens, pResult);
+
+    return true;
+}
+
+bool parseGpvtgMessageIfValid(const Message* pGpvtgMessage, GpsData* pResult)
+{
+    NmeaTokens tokens;
+
+    if (!pGpvtgMessage || !pResult || !tokenizeMessage(pGpvtgMessage, &tokens) || !isChecksumValid(&tokens))
+    {
+        return false;
     }
+
+    parseGpvtgFields(&tokens, pResult);
+
+    return true;
 }
 
-void parseGpvtgMessageIfValid(const Message* pGpvtgMessage, GpsData* pResult)
+bool parseGprmcMessageIfValid(const Message* pGprmcMessage, GpsData* pResult)
 {
-    GpvtgData gpvtgData;
-    NmeaParsingContext nmeaParsingContext = { pGpvtgMessage, 0 };
+    NmeaTokens tokens;
+
+    if (!pGprmcMessage || !pResult || !tokenizeMessage(pGprmcMessage, &tokens) || !isChecksumValid(&tokens))
+    {
+        return false;
+    }
+
+    parseGprmcFields(&tokens, pResult);
+
+    return true;
+}
+
+uint8_t gnssTalkerIdx(uint16_t talkerId)
+{
+    for (uint8_t i = 0; i < sizeof(NMEA_GNSS_TALKERS) / sizeof(NMEA_GNSS_TALKERS[0]); ++i)
+    {
+        if (NMEA_GNSS_TALKERS[i] == talkerId)
+        {
+            return i;
+        }
+    }
+
+    return NMEA_UNKNOWN_TALKER_IDX;
+}
+
+bool isGnssTalker(uint16_t talkerId)
+{
+    return gnssTalkerIdx(talkerId) != NMEA_UNKNOWN_TALKER_IDX;
+}
+
+uint16_t tokensTalkerId(const NmeaTokens* pTokens)
+{
+    const Message* const pMessage = pTokens->pMessage;
+
+    return pMessage->size < NMEA_HEADER_LEN ? 0 : NMEA_TALKER_ID(pMessage->message[1], pMessage->message[2]);
+}
+
+uint32_t sentenceTypeId(const Message* pMessage)
+{
+    if (pMessage->size < NMEA_HEADER_LEN || pMessage->message[0] != '$')
+    {
+        return NMEA_UNKNOWN_SENTENCE_TYPE_ID;
+    }
+
+    if (!isGnssTalker(NMEA_TALKER_ID(pMessage->message[1], pMessage->message[2])))
+    {
+        return NMEA_UNKNOWN_SENTENCE_TYPE_ID;
+    }
+
+    return NMEA_SENTENCE_TYPE_ID(pMessage->message[3], pMessage->message[4], pMessage->message[5]);
+}
+
+const NmeaSentenceParser* findSentenceParser(uint32_t sentenceTypeId)
+{
+    for (uint8_t i = 0; i < sizeof(NMEA_SENTENCE_PARSERS) / sizeof(NMEA_SENTENCE_PARSERS[0]); ++i)
+    {
+        if (NMEA_SENTENCE_PARSERS[i].sentenceTypeId == sentenceTypeId)
+        {
+            return &NMEA_SENTENCE_PARSERS[i];
+        }
+    }
+
+    return 0;
+}
+
+NMEA_MESSAGE_RESULT parseNmeaMessage(const Message* pMessage, GpsData* pResult)
+{
+    if (!pMessage || !pResult)
+    {
+        return NMR_NOT_SUPPORTED;
+    }
+
+    // sentence type is looked up before message is scanned so unsupported ones cost nothing
+
+    const NmeaSentenceParser* const pParser = findSentenceParser(sentenceTypeId(pMessage));
+    if (!pParser)
+    {
+        return NMR_NOT_SUPPORTED;
+    }
+
+    NmeaTokens tokens;
+
+    if (!tokenizeMessage(pMessage, &tokens) || !isChecksumValid(&tokens))
+    {
+        return NMR_REJECTED;
+    }
 
-    PARSE_DUMMY_TOKEN(nmeaParsingContext); // GPVTG header
-    PARSE_FIXED_POINT_UINT16_F1_DEFAULT_TO_0(nmeaParsingContext, gpvtgData.trueCourseDegrees);
-    PARSE_DUMMY_TOKEN(nmeaParsingContext); // true track type
-    PARSE_DUMMY_TOKEN(nmeaParsingContext); // not used
-    PARSE_DUMMY_TOKEN(nmeaParsingContext); // not used
-    PARSE_DUMMY_TOKEN(nmeaParsingContext); // speed in knots
-    PARSE_DUMMY_TOKEN(nmeaParsingContext); // speed in knots unit (fixed)
-    PARSE_FIXED_POINT_UINT16_F1_DEFAULT_TO_0(nmeaParsingContext, gpvtgData.speedKph);
-    // rest of the fields are ignored
+    pParser->parseFields(&tokens, pResult);
+    pResult->lastSentenceTypeId = pParser->sentenceTypeId;
 
-    pResult->gpvtgData = gpvtgData;
+    return NMR_PARSED;
 }
@@ -49,6 +49,14 @@ typedef struct GpsTime_t
     fixedPointW2F2_t seconds;
 } GpsTime;
 
+typedef struct GpsDate_t
+{
+    bool isValid;
+    uint8_t day;
+    uint8_t month;
+    uint16_t year;
+} GpsDate;
+
 typedef struct AngularCoordinate_t
 {
     bool isValid;
@@ -73,18 +81,125 @@ typedef struct GpvtgData_t
     fixedPointW3F1_t speedKph;
 } GpvtgData;
 
+typedef enum GPRMC_STATUS_t
+{
+    GPRMCS_UNKNOWN = 0,
+    GPRMCS_ACTIVE  = 'A', // valid fix
+    GPRMCS_VOID    = 'V', // receiver warning
+} GPRMC_STATUS;
+
+typedef struct GprmcData_t
+{
+    GpsTime utcTime;
+    uint8_t status; // GPRMC_STATUS
+    AngularCoordinate latitude;
+    AngularCoordinate longitude;
+    fixedPointW3F1_t speedKnots;
+    fixedPointW3F1_t trueCourseDegrees;
+    GpsDate utcDate;
+} GprmcData;
+
+// GPZDA carries 4 digit year, date is validated when it is applied
+typedef struct GpzdaData_t
+{
+    GpsTime utcTime;
+    uint8_t day;
+    uint8_t month;
+    uint16_t year;
+} GpzdaData;
+
+#define GPGSA_MAX_USED_SATELLITES_COUNT 12
+#define GPGSV_SATELLITES_PER_MESSAGE    4
+
+// used satellites of GPGSA sentences of one fix are merged, it fits two full constellation ones
+#define GPS_MAX_USED_SATELLITES_COUNT   24
+
+// GPGSV sequences of receivers used on the board don't go over 4 parts, table fits GPS and GLONASS ones
+#define GPS_MAX_SATELLITES_COUNT        32
+
+typedef struct GpgsaData_t
+{
+    uint8_t fixMode;                                  // 1 - no fix, 2 - 2D, 3 - 3D
+    uint8_t usedPrns[GPS_MAX_USED_SATELLITES_COUNT];  // unused slots are 0, sentence fills first 12
+    fixedPointW2F2_t pdop;
+    fixedPointW2F2_t hdop;
+    fixedPointW2F2_t vdop;
+} GpgsaData;
+
+typedef struct GpsSatellite_t
+{
+    uint8_t prn;
+    uint8_t elevationDegrees;
+    uint8_t snrDbHz;         // 0 if satellite isn't tracked
+    bool isUsed;             // used in the fix according to the last GPGSA sentences
+    uint16_t azimuthDegrees;
+} GpsSatellite;
+
+typedef struct GpgsvData_t
+{
+    uint8_t messagesCount;
+    uint8_t messageNumber;
+    uint8_t satellitesInViewCount;
+    GpsSatellite satellites[GPGSV_SATELLITES_PER_MESSAGE];
+} GpgsvData;
+
+/*
+ * Satellites of the GPGSV sequences of the current cycle, parts are written straight into the table as they arrive
+ * and summary is updated once the last one is received.
+ *
+ * Multi-GNSS receivers send a sequence per constellation talker ($GPGSV, $GLGSV, ...), each one is appended
+ * after the ones already received in the cycle. Cycle restarts when a talker which is already in it starts
+ * a new sequence, until all talkers complete again summary covers only those which did.
+ */
+typedef struct GpsSatellites_t
+{
+    uint8_t satellitesCount;           // entries of the table, can be less than in view if table is full
+    uint8_t satellitesInViewCount;
+    uint8_t trackedSatellitesCount;    // satellites with SNR
+    uint8_t meanSnrDbHz;               // of tracked satellites
+    uint8_t maxSnrDbHz;
+    uint8_t nextGpgsvMessageNumber;    // 0 if sequence isn't being assembled
+    uint8_t gpgsvTalkerIdx;            // GNSS talker of the sequence being assembled
+    uint8_t gpgsvCycleTalkersMask;     // GNSS talkers whose sequences of the cycle are complete
+    uint8_t gpgsvCycleSatellitesCount; // table entries of complete sequences, next one is appended after them
+    uint8_t gpgsvCycleInViewCount;
+    GpsSatellite satellites[GPS_MAX_SATELLITES_COUNT];
+} GpsSatellites;
+
 /*
  * had to choose to use floats as it seems that nmea messages precision can vary given number of sattelites? settings?
+ *
+ * GPRMC fills time, position, course and speed on its own, altitude and number of sattelites come only with GPGGA
+ *
+ * Multi-GNSS receivers send GPGSA sentence per constellation ($GPGSA and $GLGSA or several $GNGSA) right after
+ * each other, used satellites of such a run are merged and the next run replaces them.
  */
 typedef struct GpsData_t
 {
     bool isValid;
     GpggaData gpggaData;
     GpvtgData gpvtgData;
+    GpsDate utcDate;
+    GpgsaData gpgsaData;
+    GpsSatellites satellites;
+    uint32_t lastSentenceTypeId; // of the last parsed NMEA sentence, GPGSA run ends with any other one
 } GpsData;
 
-// degrees times 10^6
+typedef enum NMEA_MESSAGE_RESULT_t
+{
+    NMR_NOT_SUPPORTED = 0, // unknown talker or sentence, message is ignored
+    NMR_REJECTED      = 1, // missing or wrong checksum
+    NMR_PARSED        = 2,
+} NMEA_MESSAGE_RESULT;
+
+// degrees times 10^6 rounded to nearest, negative for southern and western hemispheres
 int32_t angularCoordinateToInt32Degrees(AngularCoordinate lat);
 
-void parseGpggaMessageIfValid(const Message* pGpggaMessage, GpsData* pResult);
-void parseGpvtgMessageIfValid(const Message* pGpvtgMessage, GpsData* pResult);
+// dispatches message to the parser of its sentence type, talker can be any GNSS one ($GP, $GN, $GL, ...)
+NMEA_MESSAGE_RESULT parseNmeaMessage(const Message* pMessage, GpsData* pResult);
+
+// return false if message is rejected because its checksum is missing or wrong,
+// fields are parsed only after checksum is verified
+bool parseGpggaMessageIfValid(const Message* pGpggaMessage, GpsData* pResult);
+bool parseGpvtgMessageIfValid(const Message* pGpvtgMessage, GpsData* pResult);
+bool parseGprmcMessageIfValid(const Message* pGprmcMessage, GpsData* pResult);
@@ -3,6 +3,7 @@
 #include <math.h>
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 
 bool isSeparator(__in uint8_t c)
 {
@@ -41,6 +42,223 @@ NMEA_PARSING_RESULT findNextTokenStart(__in NmeaParsingContext* pContext)
     }
 }
 
+bool tokenizeMessage(__in const Message* pMessage, __out NmeaTokens* pTokens)
+{
+    if (!pMessage || !pTokens)
+    {
+        return false;
+    }
+
+    pTokens->pMessage = pMessage;
+    pTokens->fieldsCount = 1;
+    pTokens->fieldStartIdx[0] = 0;
+    pTokens->checksumIdx = NMEA_NO_CHECKSUM;
+
+    const uint8_t* const pChars = pMessage->message;
+    const uint8_t size = pMessage->size;
+
+    // checksum is xor of all characters so words can be xored together and folded at the end
+
+    uint32_t checksumWord = 0;
+    uint8_t checksum = 0;
+
+    for (uint8_t i = 0; i < size; ++i)
+    {
+        // most of the characters aren't separators, skip 4 of them at once
+
+        if (i + 4 <= size)
+        {
+            uint32_t word;
+            memcpy(&word, &pChars[i], sizeof(word));
+
+            if (!NMEA_WORD_HAS_BYTE(word, ',') && !NMEA_WORD_HAS_BYTE(word, '*'))
+            {
+                checksumWord ^= word;
+                i += 3;
+                continue;
+            }
+        }
+
+        const uint8_t c = pChars[i];
+
+        if (c == '*')
+        {
+            pTokens->checksumIdx = i;
+            break;
+        }
+
+        checksum ^= c;
+
+        if (c == ',' && pTokens->fieldsCount < NMEA_MAX_FIELDS_COUNT)
+        {
+            pTokens->fieldStartIdx[pTokens->fieldsCount++] = i + 1;
+        }
+    }
+
+    checksumWord ^= checksumWord >> 16;
+    checksumWord ^= checksumWord >> 8;
+    checksum ^= (uint8_t) checksumWord;
+
+    // '$' isn't part of checksum
+
+    if (size > 0 && pChars[0] == '$')
+    {
+        checksum ^= '$';
+    }
+
+    pTokens->checksum = checksum;
+
+    return true;
+}
+
+bool parseHexDigit(__in uint8_t c, __out uint8_t* pResult)
+{
+    if (c >= '0' && c <= '9')
+    {
+        *pResult = c - '0';
+    }
+    else if (c >= 'A' && c <= 'F')
+    {
+        *pResult = c - 'A' + 10;
+    }
+    else if (c >= 'a' && c <= 'f')
+    {
+        *pResult = c - 'a' + 10;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+bool isChecksumValid(__in const NmeaTokens* pTokens)
+{
+    if (pTokens->checksumIdx == NMEA_NO_CHECKSUM || pTokens->checksumIdx + 2 >= pTokens->pMessage->size)
+    {
+        return false;
+    }
+
+    uint8_t high;
+    uint8_t low;
+
+    if (!parseHexDigit(pTokens->pMessage->message[pTokens->checksumIdx + 1], &high) ||
+        !parseHexDigit(pTokens->pMessage->message[pTokens->checksumIdx + 2], &low))
+    {
+        return false;
+    }
+
+    return ((high << 4) | low) == pTokens->checksum;
+}
+
+uint8_t presentSchemaLen(__in const NmeaTokens* pTokens, __in const NmeaFieldSchema* pSchema, __in uint8_t schemaLen)
+{
+    uint8_t i = 0;
+
+    while (i < schemaLen && pSchema[i].fieldIdx < pTokens->fieldsCount)
+    {
+        ++i;
+    }
+
+    return i;
+}
+
+NMEA_PARSING_RESULT seekField(__in const NmeaTokens* pTokens, __in uint8_t fieldIdx, __out NmeaParsingContext* pContext)
+{
+    if (fieldIdx >= pTokens->fieldsCount)
+    {
+        return NPR_UNEXPECTED_END_OF_MESSAGE;
+    }
+
+    pContext->pMessage = pTokens->pMessage;
+    pContext->tokenStartIdx = pTokens->fieldStartIdx[fieldIdx];
+
+    return NPR_VALID;
+}
+
+bool parseSchemaFields(__in const NmeaTokens* pTokens, __in const NmeaFieldSchema* pSchema, __in uint8_t schemaLen, __out void* pDestination)
+{
+    for (uint8_t i = 0; i < schemaLen; ++i)
+    {
+        NmeaParsingContext context;
+        NMEA_PARSING_RESULT result = seekField(pTokens, pSchema[i].fieldIdx, &context);
+
+        if (NPR_IS_INVALID(result))
+        {
+            return false;
+        }
+
+        void* const pField = (uint8_t*) pDestination + pSchema[i].destinationOffset;
+
+        switch (pSchema[i].type)
+        {
+            case NFT_GPS_TIME:
+            {
+                result = parseGpsTime(&context, (GpsTime*) pField);
+                break;
+            }
+            case NFT_GPS_DATE:
+            {
+                result = parseGpsDate(&context, (GpsDate*) pField);
+                break;
+            }
+            case NFT_LATITUDE:
+            {
+                result = parseAngularCoordinate(&context, ACR_LATITUDE, (AngularCoordinate*) pField);
+                break;
+            }
+            case NFT_LONGITUDE:
+            {
+                result = parseAngularCoordinate(&context, ACR_LONGITUDE, (AngularCoordinate*) pField);
+                break;
+            }
+            case NFT_HEMISPHERE:
+            {
+                result = parseHemisphere(&context, (HEMISPHERE*) pField);
+                break;
+            }
+            case NFT_CHARACTER:
+            {
+                result = parseCharacter(&context, (uint8_t*) pField);
+                break;
+            }
+            case NFT_UINT8:
+            {
+                result = parseUInt8(&context, NMEA_UNLIMITED_NUMBER_OF_CHARACTERS, (uint8_t*) pField);
+                break;
+            }
+            case NFT_FIX_TYPE:
+            {
+                uint8_t value;
+                result = parseUInt8(&context, NMEA_UNLIMITED_NUMBER_OF_CHARACTERS, &value);
+                *(GPS_FIX_TYPE*) pField = (GPS_FIX_TYPE) value;
+                break;
+            }
+            case NFT_FIXED_POINT_UINT16:
+            {
+                result = parseUInt16FixedPoint(&context, 0, pSchema[i].fractionalDigitsCount, (uint16_t*) pField);
+                break;
+            }
+            case NFT_FIXED_POINT_UINT32:
+            {
+                result = parseUInt32FixedPoint(&context, 0, pSchema[i].fractionalDigitsCount, (uint32_t*) pField);
+                break;
+            }
+            default:
+            {
+                return false;
+            }
+        }
+
+        if (NPR_IS_INVALID(result))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 NMEA_PARSING_RESULT parseUInt32FixedPoint(__in NmeaParsingContext* pContext, __in uint8_t minNumberOfWholeDigits, __in uint8_t fractionalDigitsCount, __out uint32_t* pResult)
 {
     bool ignoreRemaningCharacters = false;
@@ -323,6 +541,38 @@ NMEA_PARSING_RESULT parseHemisphere(__in NmeaParsingContext* pContext, __out HEM
     }
 }
 
+NMEA_PARSING_RESULT parseCharacter(__in NmeaParsingContext* pContext, __out uint8_t* pResult)
+{
+    *pResult = 0;
+
+    if (pContext->tokenStartIdx >= pContext->pMessage->size)
+    {
+        return NPR_UNEXPECTED_END_OF_MESSAGE;
+    }
+
+    const uint8_t c = pContext->pMessage->message[pContext->tokenStartIdx++];
+
+    if (isSeparator(c))
+    {
+        return NPR_EMPTY_VALUE;
+    }
+
+    if (pContext->tokenStartIdx >= pContext->pMessage->size)
+    {
+        return NPR_UNEXPECTED_END_OF_MESSAGE;
+    }
+    if (!isSeparator(pContext->pMessage->message[pContext->tokenStartIdx]))
+    {
+        findNextTokenStart(pContext); // skip to next token
+        return NPR_UNEXPECTED_CHARACTER_ENCOUNTERED;
+    }
+
+    ++pContext->tokenStartIdx;
+    *pResult = c;
+
+    return NPR_VALID;
+}
+
 NMEA_PARSING_RESULT parseGpsTime(__in NmeaParsingContext* pContext, __out GpsTime* pTime)
 {
     pTime->isValid = false;
@@ -384,6 +634,78 @@ NMEA_PARSING_RESULT parseGpsTime(__in NmeaParsingContext* pContext, __out GpsTim
     return NPR_VALID;
 }
 
+NMEA_PARSING_RESULT parseGpsDate(__in NmeaParsingContext* pContext, __out GpsDate* pDate)
+{
+    pDate->isValid = false;
+
+    if (pContext->tokenStartIdx >= pContext->pMessage->size)
+    {
+        return NPR_UNEXPECTED_END_OF_MESSAGE;
+    }
+    if (isSeparator(pContext->pMessage->message[pContext->tokenStartIdx]))
+    {
+        ++pContext->tokenStartIdx;
+        return NPR_EMPTY_VALUE;
+    }
+
+    NMEA_PARSING_RESULT result;
+
+    if (NPR_IS_INVALID(result = parseUInt8(pContext, 2, &pDate->day)))
+    {
+        if (result != NPR_UNEXPECTED_SEPARATOR_ENCOUNTERED)
+        {
+            findNextTokenStart(pContext); // skip to next token
+        }
+        else
+        {
+            result = NPR_NOT_ENOUGH_DIGITS;
+        }
+        return result;
+    }
+    if (NPR_IS_INVALID(result = parseUInt8(pContext, 2, &pDate->month)))
+    {
+        if (result != NPR_UNEXPECTED_SEPARATOR_ENCOUNTERED)
+        {
+            findNextTokenStart(pContext); // skip to next token
+        }
+        else
+        {
+            result = NPR_NOT_ENOUGH_DIGITS;
+        }
+        return result;
+    }
+
+    const uint32_t yearStartIdx = pContext->tokenStartIdx;
+    uint8_t year;
+
+    if (NPR_IS_INVALID(result = parseUInt8(pContext, NMEA_UNLIMITED_NUMBER_OF_CHARACTERS, &year)))
+    {
+        return result;
+    }
+
+    // year is the rest of the token including separator which has to be exactly 2 digits
+
+    if (pContext->tokenStartIdx - yearStartIdx < 3)
+    {
+        return NPR_NOT_ENOUGH_DIGITS;
+    }
+    else if (pContext->tokenStartIdx - yearStartIdx > 3)
+    {
+        return NPR_INVALID_FORMAT;
+    }
+
+    if (pDate->day < 1 || pDate->day > 31 ||
+        pDate->month < 1 || pDate->month > 12)
+    {
+        return NPR_OVERFLOW;
+    }
+
+    pDate->year = NMEA_FIRST_YEAR + year;
+    pDate->isValid = true;
+
+    return NPR_VALID;
+}
+
 NMEA_PARSING_RESULT parseAngularCoordinate(__in NmeaParsingContext* pContext, __in AngularCoordinateType angularCoordinateType, __out AngularCoordinate* pCoordinate)
 {
     pCoordinate->isValid = false;
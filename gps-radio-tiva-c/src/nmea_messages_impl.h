@@ -2,6 +2,8 @@
 
 #include "nmea_messages.h"
 
+#include <stddef.h>
+
 typedef enum AngularCoordinateType_t
 {
     ACR_LATITUDE  = 2,
@@ -13,35 +15,172 @@ typedef enum AngularCoordinateType_t
 
 #define NMEA_MAX_UINT32_DIV_10 429496729
 
-#define NPR_IS_VALID(npr) \
-    ((npr) & NPR_INVALID) == 0
+#define NMEA_KNOTS_TO_KPH_NUMERATOR   1852
+#define NMEA_KNOTS_TO_KPH_DENOMINATOR 1000
 
-#define NPR_IS_INVALID(npr) \
-    ((npr) & NPR_INVALID) != 0
+#define NMEA_FIRST_YEAR 2000
+
+#define MICRO_DEGREES_PER_DEGREE       1000000
+#define MINUTES_UNITS_PER_MICRO_DEGREE 60 // fixedPointW2F6_t minutes
+
+// header and up to 19 data fields (GPGSV has the most of the ones we might need)
+#define NMEA_MAX_FIELDS_COUNT 20
+#define NMEA_NO_CHECKSUM      255
+
+#define NMEA_WORD_HAS_ZERO_BYTE(word) \
+    ((((word) - 0x01010101UL) & ~(word) & 0x80808080UL) != 0)
+
+#define NMEA_WORD_HAS_BYTE(word, c) \
+    NMEA_WORD_HAS_ZERO_BYTE((word) ^ (0x01010101UL * (uint8_t) (c)))
 
-#define PARSE_DUMMY_TOKEN(nmeaParsingContext) \
-    if (NPR_IS_INVALID(findNextTokenStart(&(nmeaParsingContext)))) { return; }
+// "$" followed by 2 characters of talker and 3 characters of sentence type
+#define NMEA_HEADER_LEN 6
+
+#define NMEA_TALKER_ID(c0, c1) \
+    ((uint16_t) (((uint16_t) (c0) << 8) | (uint8_t) (c1)))
+
+#define NMEA_SENTENCE_TYPE_ID(c0, c1, c2) \
+    ((((uint32_t) (c0)) << 16) | (((uint32_t) (c1)) << 8) | (uint8_t) (c2))
+
+#define NMEA_UNKNOWN_SENTENCE_TYPE_ID 0
+
+#define NMEA_UNKNOWN_TALKER_IDX 0xFF
+
+typedef enum NMEA_FIELD_TYPE_t
+{
+    NFT_GPS_TIME,               // GpsTime
+    NFT_GPS_DATE,               // GpsDate
+    NFT_LATITUDE,               // AngularCoordinate, consumes hemisphere field as well
+    NFT_LONGITUDE,              // AngularCoordinate, consumes hemisphere field as well
+    NFT_HEMISPHERE,             // HEMISPHERE
+    NFT_CHARACTER,              // uint8_t single character, empty value defaults to 0
+    NFT_UINT8,                  // uint8_t, empty value defaults to 0
+    NFT_FIX_TYPE,               // GPS_FIX_TYPE parsed from uint8
+    NFT_FIXED_POINT_UINT16,     // uint16_t with given number of fractional digits, empty value defaults to 0
+    NFT_FIXED_POINT_UINT32,     // uint32_t with given number of fractional digits, empty value defaults to 0
+} NMEA_FIELD_TYPE;
+
+/*
+ * Sentence schemas, only listed fields are parsed and others are skipped without being looked at.
+ * Every entry is FIELD(destination struct, field name, field index, type, fractional digits, destination member)
+ */
 
-#define PARSE_GPS_TIME(nmeaParsingContext, utcTime) \
-    if (NPR_IS_INVALID(parseGpsTime(&(nmeaParsingContext), &(utcTime)))) { return; }
+#define NMEA_GPGGA_FIELDS(FIELD) \
+    FIELD(GpggaData, NMEA_GPGGA_UTC_TIME,             1, NFT_GPS_TIME,           0, utcTime) \
+    FIELD(GpggaData, NMEA_GPGGA_LATITUDE,             2, NFT_LATITUDE,           0, latitude) \
+    FIELD(GpggaData, NMEA_GPGGA_LONGITUDE,            4, NFT_LONGITUDE,          0, longitude) \
+    FIELD(GpggaData, NMEA_GPGGA_GPS_QUALITY,          6, NFT_FIX_TYPE,           0, fixType) \
+    FIELD(GpggaData, NMEA_GPGGA_NUMBER_OF_SATTELITES, 7, NFT_UINT8,              0, numberOfSattelitesInUse) \
+    FIELD(GpggaData, NMEA_GPGGA_ALTITUDE_MSL,         9, NFT_FIXED_POINT_UINT32, 1, altitudeMslMeters)
 
-#define PARSE_LATITUDE(nmeaParsingContext, angularCoordinate) \
-    if (NPR_IS_INVALID(parseAngularCoordinate(&(nmeaParsingContext), ACR_LATITUDE, &(angularCoordinate)))) { return; }
+#define NMEA_GPVTG_FIELDS(FIELD) \
+    FIELD(GpvtgData, NMEA_GPVTG_TRUE_COURSE, 1, NFT_FIXED_POINT_UINT16, 1, trueCourseDegrees) \
+    FIELD(GpvtgData, NMEA_GPVTG_SPEED_KPH,   7, NFT_FIXED_POINT_UINT16, 1, speedKph)
+
+#define NMEA_GPRMC_FIELDS(FIELD) \
+    FIELD(GprmcData, NMEA_GPRMC_UTC_TIME,    1, NFT_GPS_TIME,           0, utcTime) \
+    FIELD(GprmcData, NMEA_GPRMC_STATUS,      2, NFT_CHARACTER,          0, status) \
+    FIELD(GprmcData, NMEA_GPRMC_LATITUDE,    3, NFT_LATITUDE,           0, latitude) \
+    FIELD(GprmcData, NMEA_GPRMC_LONGITUDE,   5, NFT_LONGITUDE,          0, longitude) \
+    FIELD(GprmcData, NMEA_GPRMC_SPEED_KNOTS, 7, NFT_FIXED_POINT_UINT16, 1, speedKnots) \
+    FIELD(GprmcData, NMEA_GPRMC_TRUE_COURSE, 8, NFT_FIXED_POINT_UINT16, 1, trueCourseDegrees) \
+    FIELD(GprmcData, NMEA_GPRMC_UTC_DATE,    9, NFT_GPS_DATE,           0, utcDate)
+
+// local time zone fields aren't used
+#define NMEA_GPZDA_FIELDS(FIELD) \
+    FIELD(GpzdaData, NMEA_GPZDA_UTC_TIME, 1, NFT_GPS_TIME,           0, utcTime) \
+    FIELD(GpzdaData, NMEA_GPZDA_DAY,      2, NFT_UINT8,              0, day) \
+    FIELD(GpzdaData, NMEA_GPZDA_MONTH,    3, NFT_UINT8,              0, month) \
+    FIELD(GpzdaData, NMEA_GPZDA_YEAR,     4, NFT_FIXED_POINT_UINT16, 0, year)
+
+#define NMEA_GPGSA_FIELDS(FIELD) \
+    FIELD(GpgsaData, NMEA_GPGSA_FIX_MODE, 2,  NFT_UINT8,              0, fixMode) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_1,    3,  NFT_UINT8,              0, usedPrns[0]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_2,    4,  NFT_UINT8,              0, usedPrns[1]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_3,    5,  NFT_UINT8,              0, usedPrns[2]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_4,    6,  NFT_UINT8,              0, usedPrns[3]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_5,    7,  NFT_UINT8,              0, usedPrns[4]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_6,    8,  NFT_UINT8,              0, usedPrns[5]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_7,    9,  NFT_UINT8,              0, usedPrns[6]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_8,    10, NFT_UINT8,              0, usedPrns[7]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_9,    11, NFT_UINT8,              0, usedPrns[8]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_10,   12, NFT_UINT8,              0, usedPrns[9]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_11,   13, NFT_UINT8,              0, usedPrns[10]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PRN_12,   14, NFT_UINT8,              0, usedPrns[11]) \
+    FIELD(GpgsaData, NMEA_GPGSA_PDOP,     15, NFT_FIXED_POINT_UINT16, 2, pdop) \
+    FIELD(GpgsaData, NMEA_GPGSA_HDOP,     16, NFT_FIXED_POINT_UINT16, 2, hdop) \
+    FIELD(GpgsaData, NMEA_GPGSA_VDOP,     17, NFT_FIXED_POINT_UINT16, 2, vdop)
+
+#define NMEA_GPGSV_SATELLITE_FIELDS(FIELD, n) \
+    FIELD(GpgsvData, NMEA_GPGSV_PRN_##n,       4 * (n) + 0, NFT_UINT8,              0, satellites[(n) - 1].prn) \
+    FIELD(GpgsvData, NMEA_GPGSV_ELEVATION_##n, 4 * (n) + 1, NFT_UINT8,              0, satellites[(n) - 1].elevationDegrees) \
+    FIELD(GpgsvData, NMEA_GPGSV_AZIMUTH_##n,   4 * (n) + 2, NFT_FIXED_POINT_UINT16, 0, satellites[(n) - 1].azimuthDegrees) \
+    FIELD(GpgsvData, NMEA_GPGSV_SNR_##n,       4 * (n) + 3, NFT_UINT8,              0, satellites[(n) - 1].snrDbHz)
+
+// last part of the sequence has less than 4 satellites, their fields are cut off by the end of sentence
+#define NMEA_GPGSV_FIELDS(FIELD) \
+    FIELD(GpgsvData, NMEA_GPGSV_MESSAGES_COUNT,    1, NFT_UINT8, 0, messagesCount) \
+    FIELD(GpgsvData, NMEA_GPGSV_MESSAGE_NUMBER,    2, NFT_UINT8, 0, messageNumber) \
+    FIELD(GpgsvData, NMEA_GPGSV_SATELLITES_IN_VIEW, 3, NFT_UINT8, 0, satellitesInViewCount) \
+    NMEA_GPGSV_SATELLITE_FIELDS(FIELD, 1) \
+    NMEA_GPGSV_SATELLITE_FIELDS(FIELD, 2) \
+    NMEA_GPGSV_SATELLITE_FIELDS(FIELD, 3) \
+    NMEA_GPGSV_SATELLITE_FIELDS(FIELD, 4)
+
+#define NMEA_GPGSV_REQUIRED_FIELDS_COUNT 3
+
+#define NMEA_FIELD_INDEX(structType, name, fieldIdx, type, fractionalDigitsCount, member) \
+    name = (fieldIdx),
+
+#define NMEA_FIELD_SCHEMA(structType, name, fieldIdx, type, fractionalDigitsCount, member) \
+    { (fieldIdx), (type), (fractionalDigitsCount), (uint8_t) offsetof(structType, member) },
+
+#define NMEA_SCHEMA_LEN(schema) \
+    ((uint8_t) (sizeof(schema) / sizeof((schema)[0])))
+
+typedef enum NMEA_GPGGA_FIELD_t
+{
+    NMEA_GPGGA_FIELDS(NMEA_FIELD_INDEX)
+} NMEA_GPGGA_FIELD;
+
+typedef enum NMEA_GPVTG_FIELD_t
+{
+    NMEA_GPVTG_FIELDS(NMEA_FIELD_INDEX)
+} NMEA_GPVTG_FIELD;
+
+typedef enum NMEA_GPRMC_FIELD_t
+{
+    NMEA_GPRMC_FIELDS(NMEA_FIELD_INDEX)
+} NMEA_GPRMC_FIELD;
+
+typedef enum NMEA_GPZDA_FIELD_t
+{
+    NMEA_GPZDA_FIELDS(NMEA_FIELD_INDEX)
+} NMEA_GPZDA_FIELD;
 
-#define PARSE_LONGITUDE(nmeaParsingContext, angularCoordinate) \
-    if (NPR_IS_INVALID(parseAngularCoordinate(&(nmeaParsingContext), ACR_LONGITUDE, &(angularCoordinate)))) { return; }
+typedef enum NMEA_GPGSA_FIELD_t
+{
+    NMEA_GPGSA_FIELDS(NMEA_FIELD_INDEX)
+} NMEA_GPGSA_FIELD;
 
-#define PARSE_UINT8_DEFAULT_TO_0(nmeaParsingContext, result) \
-    if (NPR_IS_INVALID(parseUInt8(&(nmeaParsingContext), NMEA_UNLIMITED_NUMBER_OF_CHARACTERS, &(result)))) { return; }
+typedef enum NMEA_GPGSV_FIELD_t
+{
+    NMEA_GPGSV_FIELDS(NMEA_FIELD_INDEX)
+} NMEA_GPGSV_FIELD;
 
-#define PARSE_FIXED_POINT_UINT32_F1_DEFAULT_TO_0(nmeaParsingContext, result) \
-    if (NPR_IS_INVALID(parseUInt32FixedPoint(&(nmeaParsingContext), 0, 1, &(result)))) { return; }
+typedef struct NmeaFieldSchema_t
+{
+    uint8_t fieldIdx;
+    uint8_t type; // NMEA_FIELD_TYPE
+    uint8_t fractionalDigitsCount;
+    uint8_t destinationOffset;
+} NmeaFieldSchema;
 
-#define PARSE_FIXED_POINT_UINT16_F1_DEFAULT_TO_0(nmeaParsingContext, result) \
-    if (NPR_IS_INVALID(parseUInt16FixedPoint(&(nmeaParsingContext), 0, 1, &(result)))) { return; }
+#define NPR_IS_VALID(npr) \
+    ((npr) & NPR_INVALID) == 0
 
-#define PARSE_FIXED_POINT_UINT16_F2_DEFAULT_TO_0(nmeaParsingContext, result) \
-    if (NPR_IS_INVALID(parseUInt16FixedPoint(&(nmeaParsingContext), 0, 2, &(result)))) { return; }
+#define NPR_IS_INVALID(npr) \
+    ((npr) & NPR_INVALID) != 0
 
 typedef struct NmeaParsingContext_t
 {
@@ -49,6 +188,44 @@ typedef struct NmeaParsingContext_t
     uint32_t tokenStartIdx;
 } NmeaParsingContext;
 
+/*
+ * Offsets of all fields of the message found in a single pass, field 0 is the header
+ */
+typedef struct NmeaTokens_t
+{
+    const Message* pMessage;
+    uint8_t fieldsCount;
+    uint8_t fieldStartIdx[NMEA_MAX_FIELDS_COUNT];
+    uint8_t checksumIdx; // index of '*' or NMEA_NO_CHECKSUM
+    uint8_t checksum;    // xor of characters between '$' and '*'
+} NmeaTokens;
+
+// destination of schema fields of any supported sentence
+typedef union NmeaSentenceFields_t
+{
+    GpggaData gpggaData;
+    GpvtgData gpvtgData;
+    GprmcData gprmcData;
+    GpzdaData gpzdaData;
+    GpgsaData gpgsaData;
+    GpgsvData gpgsvData;
+} NmeaSentenceFields;
+
+typedef void (*NmeaFieldsParser)(const NmeaTokens* pTokens, GpsData* pResult);
+
+// validates parsed fields of the sentence and updates GPS data with them, talker tells apart GNSS constellations
+typedef void (*NmeaFieldsApplier)(const NmeaSentenceFields* pFields, uint16_t talkerId, GpsData* pResult);
+
+typedef struct NmeaSentenceParser_t
+{
+    uint32_t sentenceTypeId;
+    NmeaFieldsParser parseFields;
+    const NmeaFieldSchema* pSchema;
+    uint8_t schemaLen;
+    uint8_t requiredSchemaLen; // leading schema fields which can't be cut off by the end of sentence
+    NmeaFieldsApplier applyFields;
+} NmeaSentenceParser;
+
 typedef enum NMEA_PARSING_RESULT_t
 {
     NPR_VALID                            = 0x00,
@@ -66,7 +243,23 @@ bool canUInt32Overflow(uint32_t previousValue, uint8_t newDigit);
 
 NMEA_PARSING_RESULT findNextTokenStart(__in NmeaParsingContext* pContext);
 
+/*
+ * Fields past NMEA_MAX_FIELDS_COUNT aren't indexed, checksum is still located and calculated
+ */
+bool tokenizeMessage(__in const Message* pMessage, __out NmeaTokens* pTokens);
+bool parseHexDigit(__in uint8_t c, __out uint8_t* pResult);
+bool isChecksumValid(__in const NmeaTokens* pTokens);
+
+/*
+ * Parses fields listed in the schema into the destination, stops at the first invalid field and returns false
+ */
+bool parseSchemaFields(__in const NmeaTokens* pTokens, __in const NmeaFieldSchema* pSchema, __in uint8_t schemaLen, __out void* pDestination);
+// number of leading schema fields which are present in the message
+uint8_t presentSchemaLen(__in const NmeaTokens* pTokens, __in const NmeaFieldSchema* pSchema, __in uint8_t schemaLen);
+NMEA_PARSING_RESULT seekField(__in const NmeaTokens* pTokens, __in uint8_t fieldIdx, __out NmeaParsingContext* pContext);
+
 NMEA_PARSING_RESULT parseHemisphere(__in NmeaParsingContext* pContext, __out HEMISPHERE* pHemisphere);
+NMEA_PARSING_RESULT parseCharacter(__in NmeaParsingContext* pContext, __out uint8_t* pResult);
 
 /*
  * maxFractionalDigitsCount - higher precision than specified will be ignored
@@ -82,4 +275,38 @@ NMEA_PARSING_RESULT parseUInt16FixedPoint(__in NmeaParsingContext* pContext, __i
 NMEA_PARSING_RESULT parseUInt8(__in NmeaParsingContext* pContext, __in uint32_t maxNumberOfCharactersToConsider, __out uint8_t* pResult);
 
 NMEA_PARSING_RESULT parseGpsTime(__in NmeaParsingContext* pContext, __out GpsTime* pTime);
+
+/*
+ * ddmmyy, years are counted from 2000
+ */
+NMEA_PARSING_RESULT parseGpsDate(__in NmeaParsingContext* pContext, __out GpsDate* pDate);
 NMEA_PARSING_RESULT parseAngularCoordinate(__in NmeaParsingContext* pContext, __in AngularCoordinateType angularCoordinateType, __out AngularCoordinate* pCoordinate);
+
+void applyGpggaFields(__in const NmeaSentenceFields* pFields, __in uint16_t talkerId, __out GpsData* pResult);
+void applyGpvtgFields(__in const NmeaSentenceFields* pFields, __in uint16_t talkerId, __out GpsData* pResult);
+void applyGprmcFields(__in const NmeaSentenceFields* pFields, __in uint16_t talkerId, __out GpsData* pResult);
+void applyGpzdaFields(__in const NmeaSentenceFields* pFields, __in uint16_t talkerId, __out GpsData* pResult);
+void applyGpgsaFields(__in const NmeaSentenceFields* pFields, __in uint16_t talkerId, __out GpsData* pResult);
+void applyGpgsvFields(__in const NmeaSentenceFields* pFields, __in uint16_t talkerId, __out GpsData* pResult);
+void parseGpggaFields(__in const NmeaTokens* pTokens, __out GpsData* pResult);
+void parseGpvtgFields(__in const NmeaTokens* pTokens, __out GpsData* pResult);
+void parseGprmcFields(__in const NmeaTokens* pTokens, __out GpsData* pResult);
+void parseGpzdaFields(__in const NmeaTokens* pTokens, __out GpsData* pResult);
+void parseGpgsaFields(__in const NmeaTokens* pTokens, __out GpsData* pResult);
+void parseGpgsvFields(__in const NmeaTokens* pTokens, __out GpsData* pResult);
+
+/*
+ * Marks satellites used in the fix and recalculates SNR summary of the satellite table
+ */
+void updateSatellitesSummary(__inout GpsData* pGpsData);
+
+// index of the talker in the list of GNSS ones or NMEA_UNKNOWN_TALKER_IDX
+uint8_t gnssTalkerIdx(__in uint16_t talkerId);
+bool isGnssTalker(__in uint16_t talkerId);
+uint16_t tokensTalkerId(__in const NmeaTokens* pTokens);
+
+/*
+ * Sentence type packed into single integer, NMEA_UNKNOWN_SENTENCE_TYPE_ID if talker isn't a GNSS one
+ */
+uint32_t sentenceTypeId(__in const Message* pMessage);
+const NmeaSentenceParser* findSentenceParser(__in uint32_t sentenceTypeId);
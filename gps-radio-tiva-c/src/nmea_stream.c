@@ -0,0 +1,581 @@
+#include "nmea_stream_impl.h"
+
+#include <ctype.h>
+#include <string.h>
+
+void initializeNmeaStreamParser(NmeaStreamParser* pParser)
+{
+    memset(pParser, 0, sizeof(NmeaStreamParser));
+}
+
+bool isCoordinateField(uint8_t type)
+{
+    return type == NFT_LATITUDE || type == NFT_LONGITUDE;
+}
+
+const NmeaFieldSchema* findSchemaField(const NmeaSentenceParser* pParser, uint8_t fieldIdx)
+{
+    for (uint8_t i = 0; i < pParser->schemaLen; ++i)
+    {
+        if (pParser->pSchema[i].fieldIdx == fieldIdx)
+        {
+            return &pParser->pSchema[i];
+        }
+    }
+    return 0;
+}
+
+bool hemisphereFromCharacter(uint8_t c, HEMISPHERE* pHemisphere)
+{
+    switch (toupper(c))
+    {
+        case 'N':
+        {
+            *pHemisphere = H_NORTH;
+            return true;
+        }
+        case 'S':
+        {
+            *pHemisphere = H_SOUTH;
+            return true;
+        }
+        case 'E':
+        {
+            *pHemisphere = H_EAST;
+            return true;
+        }
+        case 'W':
+        {
+            *pHemisphere = H_WEST;
+            return true;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+uint8_t maxFractionalDigitsCount(const NmeaFieldSchema* pField)
+{
+    if (pField->type == NFT_GPS_TIME)
+    {
+        return 2;
+    }
+    else if (isCoordinateField(pField->type))
+    {
+        return 6;
+    }
+    else
+    {
+        return pField->fractionalDigitsCount;
+    }
+}
+
+void accumulateFieldCharacter(NmeaFieldAccumulator* pAccumulator, const NmeaFieldSchema* pField, bool isHemisphereField, uint8_t c)
+{
+    if (isHemisphereField || pField->type == NFT_HEMISPHERE || pField->type == NFT_CHARACTER)
+    {
+        pAccumulator->hemisphere = c;
+        if (pAccumulator->hemisphereCharactersCount < 255)
+        {
+            ++pAccumulator->hemisphereCharactersCount;
+        }
+        return;
+    }
+
+    // degrees digits count of coordinates is the same as AngularCoordinateType value
+
+    const uint8_t degreesDigitsCount = pField->type == NFT_LATITUDE ? ACR_LATITUDE : pField->type == NFT_LONGITUDE ? ACR_LONGITUDE : 0;
+
+    if (pAccumulator->charactersCount < degreesDigitsCount)
+    {
+        if (isdigit(c))
+        {
+            pAccumulator->degrees = pAccumulator->degrees * 10 + (c - '0');
+        }
+        else
+        {
+            pAccumulator->isInvalid = true;
+        }
+    }
+    else if (c == '.')
+    {
+        if (pAccumulator->isPointEncountered)
+        {
+            pAccumulator->isInvalid = true;
+        }
+        pAccumulator->isPointEncountered = true;
+    }
+    else if (isdigit(c))
+    {
+        const uint8_t d = c - '0';
+
+        if (pAccumulator->isPointEncountered && pAccumulator->fractionalDigitsCount >= maxFractionalDigitsCount(pField))
+        {
+            // precision higher than needed is ignored
+        }
+        else if (canUInt32Overflow(pAccumulator->number, d))
+        {
+            pAccumulator->isInvalid = true;
+        }
+        else
+        {
+            pAccumulator->number = pAccumulator->number * 10 + d;
+
+            if (pAccumulator->isPointEncountered)
+            {
+                ++pAccumulator->fractionalDigitsCount;
+            }
+            else if (pAccumulator->wholeDigitsCount < 255)
+            {
+                ++pAccumulator->wholeDigitsCount;
+            }
+        }
+    }
+    else
+    {
+        pAccumulator->isInvalid = true;
+    }
+
+    if (pAccumulator->charactersCount < 255)
+    {
+        ++pAccumulator->charactersCount;
+    }
+}
+
+bool finalizeFixedPointNumber(NmeaFieldAccumulator* pAccumulator, uint8_t fractionalDigitsCount)
+{
+    if (pAccumulator->isInvalid)
+    {
+        return false;
+    }
+
+    // missing fractional digits are filled with zeroes
+
+    if (pAccumulator->number)
+    {
+        for (uint8_t i = pAccumulator->fractionalDigitsCount; i < fractionalDigitsCount; ++i)
+        {
+            if (canUInt32Overflow(pAccumulator->number, 0))
+            {
+                return false;
+            }
+            pAccumulator->number *= 10;
+        }
+    }
+
+    return true;
+}
+
+bool finalizeField(NmeaFieldAccumulator* pAccumulator, const NmeaFieldSchema* pField, void* pDestination)
+{
+    void* const pValue = (uint8_t*) pDestination + pField->destinationOffset;
+
+    switch (pField->type)
+    {
+        case NFT_GPS_TIME:
+        {
+            GpsTime* const pTime = (GpsTime*) pValue;
+            pTime->isValid = false;
+
+            if (pAccumulator->charactersCount == 0)
+            {
+                return true;
+            }
+
+            if (pAccumulator->wholeDigitsCount != 6 || !finalizeFixedPointNumber(pAccumulator, 2))
+            {
+                return false;
+            }
+
+            // hhmmss.ss
+            pTime->hours = (uint8_t) (pAccumulator->number / 1000000);
+            pTime->minutes = (uint8_t) (pAccumulator->number / 10000 % 100);
+            pTime->seconds = (fixedPointW2F2_t) (pAccumulator->number % 10000);
+
+            if (pTime->hours > 23 || pTime->minutes > 59 || pTime->seconds > 5999)
+            {
+                return false;
+            }
+
+            pTime->isValid = true;
+            return true;
+        }
+        case NFT_GPS_DATE:
+        {
+            GpsDate* const pDate = (GpsDate*) pValue;
+            pDate->isValid = false;
+
+            if (pAccumulator->charactersCount == 0)
+            {
+                return true;
+            }
+
+            if (pAccumulator->isInvalid || pAccumulator->isPointEncountered || pAccumulator->wholeDigitsCount != 6)
+            {
+                return false;
+            }
+
+            // ddmmyy
+            pDate->day = (uint8_t) (pAccumulator->number / 10000);
+            pDate->month = (uint8_t) (pAccumulator->number / 100 % 100);
+            pDate->year = (uint16_t) (NMEA_FIRST_YEAR + pAccumulator->number % 100);
+
+            if (pDate->day < 1 || pDate->day > 31 || pDate->month < 1 || pDate->month > 12)
+            {
+                return false;
+            }
+
+            pDate->isValid = true;
+            return true;
+        }
+        case NFT_LATITUDE:
+        case NFT_LONGITUDE:
+        {
+            AngularCoordinate* const pCoordinate = (AngularCoordinate*) pValue;
+            pCoordinate->isValid = false;
+
+            const bool isCoordinateEmpty = pAccumulator->charactersCount == 0;
+            const bool isHemisphereEmpty = pAccumulator->hemisphereCharactersCount == 0;
+
+            if (isCoordinateEmpty || isHemisphereEmpty)
+            {
+                pCoordinate->hemisphere = H_UNKNOWN;
+                return isCoordinateEmpty && isHemisphereEmpty;
+            }
+
+            const uint8_t degreesDigitsCount = pField->type == NFT_LATITUDE ? ACR_LATITUDE : ACR_LONGITUDE;
+
+            if (pAccumulator->charactersCount < degreesDigitsCount ||
+                pAccumulator->wholeDigitsCount < 2 ||
+                pAccumulator->hemisphereCharactersCount != 1 ||
+                !finalizeFixedPointNumber(pAccumulator, 6) ||
+                !hemisphereFromCharacter(pAccumulator->hemisphere, &pCoordinate->hemisphere))
+            {
+                return false;
+            }
+
+            if (pAccumulator->degrees >= 256)
+            {
+                return false;
+            }
+
+            pCoordinate->degrees = (uint8_t) pAccumulator->degrees;
+            pCoordinate->minutes = pAccumulator->number;
+
+            if (pCoordinate->minutes >= 60000000)
+            {
+                return false;
+            }
+
+            if (pField->type == NFT_LATITUDE)
+            {
+                if ((pCoordinate->hemisphere != H_NORTH && pCoordinate->hemisphere != H_SOUTH) || pCoordinate->degrees >= 91)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                if ((pCoordinate->hemisphere != H_EAST && pCoordinate->hemisphere != H_WEST) || pCoordinate->degrees >= 181)
+                {
+                    return false;
+                }
+            }
+
+            pCoordinate->isValid = true;
+            return true;
+        }
+        case NFT_HEMISPHERE:
+        {
+            HEMISPHERE* const pHemisphere = (HEMISPHERE*) pValue;
+
+            if (pAccumulator->hemisphereCharactersCount == 0)
+            {
+                *pHemisphere = H_UNKNOWN;
+                return true;
+            }
+
+            return pAccumulator->hemisphereCharactersCount == 1 && hemisphereFromCharacter(pAccumulator->hemisphere, pHemisphere);
+        }
+        case NFT_CHARACTER:
+        {
+            *(uint8_t*) pValue = 0;
+
+            if (pAccumulator->hemisphereCharactersCount == 0)
+            {
+                return true;
+            }
+            if (pAccumulator->hemisphereCharactersCount != 1)
+            {
+                return false;
+            }
+
+            *(uint8_t*) pValue = pAccumulator->hemisphere;
+            return true;
+        }
+        case NFT_UINT8:
+        case NFT_FIX_TYPE:
+        {
+            if (pAccumulator->isInvalid || pAccumulator->isPointEncountered || pAccumulator->number > 255)
+            {
+                return false;
+            }
+
+            if (pField->type == NFT_FIX_TYPE)
+            {
+                *(GPS_FIX_TYPE*) pValue = (GPS_FIX_TYPE) pAccumulator->number;
+            }
+            else
+            {
+                *(uint8_t*) pValue = (uint8_t) pAccumulator->number;
+            }
+            return true;
+        }
+        case NFT_FIXED_POINT_UINT16:
+        {
+            if (!finalizeFixedPointNumber(pAccumulator, pField->fractionalDigitsCount) || pAccumulator->number > 65535)
+            {
+                return false;
+            }
+
+            *(uint16_t*) pValue = (uint16_t) pAccumulator->number;
+            return true;
+        }
+        case NFT_FIXED_POINT_UINT32:
+        {
+            if (!finalizeFixedPointNumber(pAccumulator, pField->fractionalDigitsCount))
+            {
+                return false;
+            }
+
+            *(uint32_t*) pValue = pAccumulator->number;
+            return true;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+void beginField(NmeaStreamParser* pParser)
+{
+    // hemisphere is the second half of a coordinate so coordinate keeps accumulating
+
+    if (pParser->pField && isCoordinateField(pParser->pField->type) && !pParser->isHemisphereField)
+    {
+        pParser->isHemisphereField = true;
+        return;
+    }
+
+    pParser->isHemisphereField = false;
+    pParser->pField = findSchemaField(pParser->pParser, pParser->fieldIdx);
+    memset(&pParser->accumulator, 0, sizeof(pParser->accumulator));
+}
+
+void endField(NmeaStreamParser* pParser)
+{
+    if (!pParser->pField || (isCoordinateField(pParser->pField->type) && !pParser->isHemisphereField))
+    {
+        return;
+    }
+
+    if (!finalizeField(&pParser->accumulator, pParser->pField, &pParser->fields))
+    {
+        pParser->areFieldsValid = false;
+    }
+    ++pParser->parsedFieldsCount;
+}
+
+NMEA_MESSAGE_RESULT rejectSentence(NmeaStreamParser* pParser)
+{
+    pParser->state = NSS_WAITING_FOR_START;
+    ++pParser->rejectedCount;
+    return NMR_REJECTED;
+}
+
+NMEA_MESSAGE_RESULT completeSentence(NmeaStreamParser* pParser)
+{
+    pParser->state = NSS_WAITING_FOR_START;
+
+    if (pParser->checksum != pParser->receivedChecksum)
+    {
+        ++pParser->rejectedCount;
+        return NMR_REJECTED;
+    }
+
+    // like the message parser sentence updates data only if all its required fields are there and valid,
+    // fields cut off by the end of sentence are left zeroed
+
+    if (pParser->parsedFieldsCount >= pParser->pParser->requiredSchemaLen && pParser->areFieldsValid)
+    {
+        pParser->pParser->applyFields(&pParser->fields, pParser->talkerId, &pParser->gpsData);
+    }
+    pParser->gpsData.lastSentenceTypeId = pParser->sentenceTypeId;
+
+    const uint8_t publishedGpsDataIdx = pParser->publishedGpsDataIdx ^ 1;
+    pParser->publishedGpsData[publishedGpsDataIdx] = pParser->gpsData;
+    pParser->publishedGpsDataIdx = publishedGpsDataIdx;
+    ++pParser->publishedCount;
+
+    return NMR_PARSED;
+}
+
+NMEA_MESSAGE_RESULT parseNmeaCharacter(NmeaStreamParser* pParser, uint8_t c)
+{
+    if (c == '$')
+    {
+        // start of the sentence always resynchronizes parser, unfinished one is lost
+
+        const bool wasSentenceTruncated = pParser->state != NSS_WAITING_FOR_START && pParser->state != NSS_HEADER;
+
+        pParser->state = NSS_HEADER;
+        pParser->checksum = 0;
+        pParser->headerLen = 0;
+        pParser->talkerId = 0;
+        pParser->sentenceTypeId = 0;
+
+        if (wasSentenceTruncated)
+        {
+            ++pParser->rejectedCount;
+            return NMR_REJECTED;
+        }
+        return NMR_NOT_SUPPORTED;
+    }
+
+    switch (pParser->state)
+    {
+        case NSS_HEADER:
+        {
+            if (c == ',')
+            {
+                pParser->pParser = 0;
+
+                if (pParser->headerLen == NMEA_HEADER_LEN - 1 && isGnssTalker(pParser->talkerId))
+                {
+                    pParser->pParser = findSentenceParser(pParser->sentenceTypeId);
+                }
+
+                if (!pParser->pParser)
+                {
+                    // unsupported sentence isn't looked at any further
+                    pParser->state = NSS_WAITING_FOR_START;
+                    break;
+                }
+
+                pParser->checksum ^= c;
+                pParser->state = NSS_FIELDS;
+                pParser->fieldIdx = 1;
+                pParser->parsedFieldsCount = 0;
+                pParser->areFieldsValid = true;
+                pParser->pField = 0;
+                pParser->isHemisphereField = false;
+                memset(&pParser->fields, 0, sizeof(pParser->fields));
+                beginField(pParser);
+            }
+            else if (c == '*' || pParser->headerLen >= NMEA_HEADER_LEN - 1)
+            {
+                pParser->state = NSS_WAITING_FOR_START;
+            }
+            else
+            {
+                pParser->checksum ^= c;
+
+                if (pParser->headerLen < 2)
+                {
+                    pParser->talkerId = (uint16_t) ((pParser->talkerId << 8) | c);
+                }
+                else
+                {
+                    pParser->sentenceTypeId = (pParser->sentenceTypeId << 8) | c;
+                }
+                ++pParser->headerLen;
+            }
+            break;
+        }
+        case NSS_FIELDS:
+        {
+            if (c == ',')
+            {
+                pParser->checksum ^= c;
+                endField(pParser);
+                if (pParser->fieldIdx < 255)
+                {
+                    ++pParser->fieldIdx;
+                }
+                beginField(pParser);
+            }
+            else if (c == '*')
+            {
+                endField(pParser);
+                pParser->state = NSS_CHECKSUM_HIGH;
+            }
+            else
+            {
+                pParser->checksum ^= c;
+                if (pParser->pField)
+                {
+                    accumulateFieldCharacter(&pParser->accumulator, pParser->pField, pParser->isHemisphereField, c);
+                }
+            }
+            break;
+        }
+        case NSS_CHECKSUM_HIGH:
+        case NSS_CHECKSUM_LOW:
+        {
+            uint8_t d;
+
+            if (!parseHexDigit(c, &d))
+            {
+                return rejectSentence(pParser);
+            }
+
+            if (pParser->state == NSS_CHECKSUM_HIGH)
+            {
+                pParser->receivedChecksum = d << 4;
+                pParser->state = NSS_CHECKSUM_LOW;
+            }
+            else
+            {
+                pParser->receivedChecksum |= d;
+                pParser->state = NSS_WAITING_FOR_END;
+            }
+            break;
+        }
+        case NSS_WAITING_FOR_END:
+        {
+            if (c == '\n')
+            {
+                return completeSentence(pParser);
+            }
+            else if (c != '\r')
+            {
+                return rejectSentence(pParser);
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    return NMR_NOT_SUPPORTED;
+}
+
+bool readNmeaStreamGpsData(NmeaStreamParser* pParser, GpsData* pResult)
+{
+    const uint32_t publishedCount = pParser->publishedCount;
+
+    if (publishedCount == pParser->readCount)
+    {
+        return false;
+    }
+
+    pParser->readCount = publishedCount;
+    *pResult = pParser->publishedGpsData[pParser->publishedGpsDataIdx];
+
+    return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+/*
+ * Incremental NMEA parser fed one character at a time straight from UART receive interrupt.
+ *
+ * Checksum, field counting and conversion of the fields listed in sentence schema happen as
+ * characters arrive so there is no message buffering or copying. Sentence with valid checksum
+ * updates GPS data which is published at the end of line, main loop picks it up with
+ * readNmeaStreamGpsData().
+ */
+
+#include "nmea_messages_impl.h"
+
+typedef enum NMEA_STREAM_STATE_t
+{
+    NSS_WAITING_FOR_START = 0, // skipping characters until '$'
+    NSS_HEADER,
+    NSS_FIELDS,
+    NSS_CHECKSUM_HIGH,
+    NSS_CHECKSUM_LOW,
+    NSS_WAITING_FOR_END,       // checksum is received, sentence is complete at '\n'
+} NMEA_STREAM_STATE;
+
+typedef struct NmeaFieldAccumulator_t
+{
+    uint32_t number;
+    uint16_t degrees;
+    uint8_t charactersCount;
+    uint8_t wholeDigitsCount;
+    uint8_t fractionalDigitsCount;
+    bool isPointEncountered;
+    bool isInvalid;
+    uint8_t hemisphereCharactersCount; // hemisphere or single character field
+    uint8_t hemisphere;
+} NmeaFieldAccumulator;
+
+typedef struct NmeaStreamParser_t
+{
+    NMEA_STREAM_STATE state;
+    uint8_t checksum;
+    uint8_t receivedChecksum;
+    uint8_t headerLen;
+    uint16_t talkerId;
+    uint32_t sentenceTypeId;
+    const NmeaSentenceParser* pParser;
+    const NmeaFieldSchema* pField;    // schema entry of the field being received, null if field is skipped
+    bool isHemisphereField;           // field being received is hemisphere of pField coordinate
+    uint8_t fieldIdx;
+    uint8_t parsedFieldsCount;
+    bool areFieldsValid;
+    NmeaFieldAccumulator accumulator;
+    NmeaSentenceFields fields;
+    GpsData gpsData;                  // owned by the interrupt handler
+
+    // gps data is published to the slot which isn't being read, sentences are way longer
+    // than it takes to copy the other slot
+    GpsData publishedGpsData[2];
+    volatile uint8_t publishedGpsDataIdx;
+    volatile uint32_t publishedCount;
+    uint32_t readCount;
+    volatile uint32_t rejectedCount;  // sentences with wrong checksum
+} NmeaStreamParser;
+
+void initializeNmeaStreamParser(NmeaStreamParser* pParser);
+
+// to be called from UART receive interrupt, returns NMR_PARSED when GPS data was published
+NMEA_MESSAGE_RESULT parseNmeaCharacter(NmeaStreamParser* pParser, uint8_t c);
+
+// to be called from main loop, returns false if nothing was published since the last call
+bool readNmeaStreamGpsData(NmeaStreamParser* pParser, GpsData* pResult);
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "nmea_stream.h"
+
+bool isCoordinateField(uint8_t type);
+const NmeaFieldSchema* findSchemaField(const NmeaSentenceParser* pParser, uint8_t fieldIdx);
+bool hemisphereFromCharacter(uint8_t c, HEMISPHERE* pHemisphere);
+
+// fractional digits kept for the field, time has 2 and coordinate minutes have 6
+uint8_t maxFractionalDigitsCount(const NmeaFieldSchema* pField);
+
+void accumulateFieldCharacter(NmeaFieldAccumulator* pAccumulator, const NmeaFieldSchema* pField, bool isHemisphereField, uint8_t c);
+bool finalizeFixedPointNumber(NmeaFieldAccumulator* pAccumulator, uint8_t fractionalDigitsCount);
+
+// converts accumulated characters into schema field of the destination, false if they aren't valid
+bool finalizeField(NmeaFieldAccumulator* pAccumulator, const NmeaFieldSchema* pField, void* pDestination);
+
+void beginField(NmeaStreamParser* pParser);
+void endField(NmeaStreamParser* pParser);
+NMEA_MESSAGE_RESULT rejectSentence(NmeaStreamParser* pParser);
+NMEA_MESSAGE_RESULT completeSentence(NmeaStreamParser* pParser);
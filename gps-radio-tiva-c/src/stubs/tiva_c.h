@@ -9,3 +9,6 @@ void disableAprsPwm(void) {}
 
 void clearAprsPwmInterrupt() {}
 void setAprsPwmPulseWidth(uint32_t pulseWidth) {}
+
+bool disableInterrupts() { return false; }
+void restoreInterrupts(bool wereDisabled) {}
@@ -14,6 +14,7 @@
 
 static uint32_t timerSeconds = 0;
 static uint32_t watchdogFeed = 0;
+static uint32_t timerTicksPerMicrosecond = 1;
 
 void initializeTimer(void)
 {
@@ -28,6 +29,12 @@ void initializeTimer(void)
     MAP_TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
     MAP_TimerEnable(TIMER0_BASE, TIMER_A);
     MAP_IntEnable(INT_TIMER0A);
+    // Timer 1 just counts down from the full 32 bit range (no interrupt)
+    timerTicksPerMicrosecond = MAP_SysCtlClockGet() / 1000000U;
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
+    MAP_TimerConfigure(TIMER1_BASE, TIMER_CFG_PERIODIC);
+    MAP_TimerLoadSet(TIMER1_BASE, TIMER_A, 0xFFFFFFFFU);
+    MAP_TimerEnable(TIMER1_BASE, TIMER_A);
     // Prepare the watchdog, use WDG0 as WDG1 was locking up
     MAP_IntPrioritySet(INT_WATCHDOG, 0x00);
     MAP_WatchdogUnlock(WATCHDOG0_BASE);
@@ -41,6 +48,16 @@ uint32_t getSecondsSinceStart(void)
     return timerSeconds;
 }
 
+uint32_t getTimerTicks(void)
+{
+    return ~MAP_TimerValueGet(TIMER1_BASE, TIMER_A);
+}
+
+uint32_t timerTicksToMicroseconds(uint32_t ticks)
+{
+    return ticks / timerTicksPerMicrosecond;
+}
+
 void startWatchdog(void)
 {
 #ifndef DEBUG
@@ -11,3 +11,6 @@ void feedWatchdog(void);
 void startWatchdog(void);
 
 uint32_t getSecondsSinceStart(void);
+// Free running system clock tick count, wraps around (in under 90 s at 50 MHz), for measuring short intervals
+uint32_t getTimerTicks(void);
+uint32_t timerTicksToMicroseconds(uint32_t ticks);
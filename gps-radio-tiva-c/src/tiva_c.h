@@ -6,6 +6,7 @@
 #include <inc/hw_memmap.h>
 
 #include <driverlib/rom.h>
+#include <driverlib/interrupt.h>
 #include <driverlib/pwm.h>
 #include <driverlib/rom_map.h>
 
@@ -19,3 +20,7 @@ void disableAprsPwm(void);
 
 #define clearAprsPwmInterrupt() MAP_PWMGenIntClear(PWM0_BASE, PWM_GEN_0, PWM_INT_CNT_ZERO)
 #define setAprsPwmPulseWidth(pulseWidth) MAP_PWMPulseWidthSet(PWM0_BASE, PWM_OUT_0, (pulseWidth))
+
+// returns true if interrupts were already disabled so nested calls restore proper state
+#define disableInterrupts() MAP_IntMasterDisable()
+#define restoreInterrupts(wereDisabled) if (!(wereDisabled)) { MAP_IntMasterEnable(); }
@@ -0,0 +1,367 @@
+#include "tsip_impl.h"
+
+#include <string.h>
+
+#define TSIP_HALF_WEEK_SECONDS (GPS_SECONDS_PER_WEEK / 2)
+
+void initializeTsipParser(TsipParser* pParser)
+{
+    memset(pParser, 0, sizeof(TsipParser));
+}
+
+uint8_t appendStuffedTsipByte(uint8_t* pPacket, uint8_t packetLen, uint8_t c)
+{
+    pPacket[packetLen++] = c;
+    if (c == TSIP_DLE)
+    {
+        pPacket[packetLen++] = TSIP_DLE;
+    }
+    return packetLen;
+}
+
+uint8_t createTsipPacket(uint8_t id, const uint8_t* pData, uint8_t dataLen, uint8_t* pPacket)
+{
+    uint8_t packetLen = 0;
+
+    pPacket[packetLen++] = TSIP_DLE;
+    pPacket[packetLen++] = id;
+
+    for (uint8_t i = 0; i < dataLen; ++i)
+    {
+        packetLen = appendStuffedTsipByte(pPacket, packetLen, pData[i]);
+    }
+
+    pPacket[packetLen++] = TSIP_DLE;
+    pPacket[packetLen++] = TSIP_ETX;
+
+    return packetLen;
+}
+
+uint8_t createTsipIoOptionsPacket(uint8_t* pPacket)
+{
+    static const uint8_t ioOptions[TSIP_IO_OPTIONS_LEN] =
+    {
+        TSIP_IO_OPTIONS_POSITION, TSIP_IO_OPTIONS_VELOCITY, TSIP_IO_OPTIONS_TIMING, TSIP_IO_OPTIONS_AUXILIARY
+    };
+
+    return createTsipPacket(TSIP_IO_OPTIONS_ID, ioOptions, sizeof(ioOptions), pPacket);
+}
+
+void beginTsipPacket(TsipParser* pParser, uint8_t id)
+{
+    pParser->id = id;
+    pParser->dataLen = 0;
+    pParser->isTooLong = false;
+    pParser->state = TPS_DATA;
+}
+
+void appendTsipData(TsipParser* pParser, uint8_t c)
+{
+    if (pParser->dataLen < TSIP_MAX_DATA_LEN)
+    {
+        pParser->data[pParser->dataLen++] = c;
+    }
+    else
+    {
+        pParser->isTooLong = true;
+    }
+}
+
+bool rejectTsipPacket(TsipParser* pParser)
+{
+    ++pParser->rejectedCount;
+    pParser->state = TPS_WAITING_FOR_DLE;
+    return false;
+}
+
+void completeTsipPacket(TsipParser* pParser)
+{
+    TsipReports* const pReports = &pParser->reports;
+    const uint8_t dataLen = pParser->dataLen;
+
+    if (pParser->isTooLong)
+    {
+        return;
+    }
+
+    switch (pParser->id)
+    {
+        case TSIP_GPS_TIME_ID:
+        {
+            if (dataLen == TSIP_GPS_TIME_LEN)
+            {
+                memcpy(pReports->gpsTime, pParser->data, TSIP_GPS_TIME_LEN);
+                pReports->hasGpsTime = true;
+            }
+            break;
+        }
+        case TSIP_DOUBLE_LLA_POSITION_ID:
+        {
+            if (dataLen == TSIP_DOUBLE_LLA_POSITION_LEN)
+            {
+                memcpy(pReports->position, pParser->data, TSIP_DOUBLE_LLA_POSITION_LEN);
+                pReports->hasPosition = true;
+            }
+            break;
+        }
+        case TSIP_ENU_VELOCITY_ID:
+        {
+            if (dataLen == TSIP_ENU_VELOCITY_LEN)
+            {
+                memcpy(pReports->velocity, pParser->data, TSIP_ENU_VELOCITY_LEN);
+                pReports->hasVelocity = true;
+            }
+            break;
+        }
+        case TSIP_ALL_IN_VIEW_ID:
+        {
+            if (dataLen >= TSIP_ALL_IN_VIEW_MIN_LEN && dataLen <= TSIP_ALL_IN_VIEW_MAX_LEN)
+            {
+                memcpy(pReports->allInView, pParser->data, dataLen);
+                pReports->allInViewLen = dataLen;
+
+                const uint8_t publishedReportsIdx = pParser->publishedReportsIdx ^ 1;
+                pParser->publishedReports[publishedReportsIdx] = *pReports;
+                pParser->publishedReportsIdx = publishedReportsIdx;
+                ++pParser->publishedCount;
+            }
+            break;
+        }
+        case TSIP_IO_OPTIONS_REPORT_ID:
+        {
+            // receiver outputs TSIP and I/O options command was accepted
+            if (dataLen == TSIP_IO_OPTIONS_LEN &&
+                pParser->data[0] == TSIP_IO_OPTIONS_POSITION &&
+                pParser->data[1] == TSIP_IO_OPTIONS_VELOCITY)
+            {
+                pParser->isTsipOutputConfirmed = true;
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+bool parseTsipByte(TsipParser* pParser, uint8_t c)
+{
+    switch (pParser->state)
+    {
+        case TPS_WAITING_FOR_DLE:
+        {
+            if (c == TSIP_DLE)
+            {
+                pParser->state = TPS_ID;
+            }
+            break;
+        }
+        case TPS_ID:
+        {
+            if (c == TSIP_DLE || c == TSIP_ETX)
+            {
+                // stuffed DLE or end of packet whose start was missed
+                pParser->state = TPS_WAITING_FOR_DLE;
+            }
+            else
+            {
+                beginTsipPacket(pParser, c);
+            }
+            break;
+        }
+        case TPS_DATA:
+        {
+            if (c == TSIP_DLE)
+            {
+                pParser->state = TPS_DATA_DLE;
+            }
+            else
+            {
+                appendTsipData(pParser, c);
+            }
+            break;
+        }
+        case TPS_DATA_DLE:
+        {
+            if (c == TSIP_DLE)
+            {
+                appendTsipData(pParser, c);
+                pParser->state = TPS_DATA;
+            }
+            else if (c == TSIP_ETX)
+            {
+                pParser->state = TPS_WAITING_FOR_DLE;
+                completeTsipPacket(pParser);
+                return true;
+            }
+            else
+            {
+                // unstuffed DLE can only start the next packet, the current one is broken
+                rejectTsipPacket(pParser);
+                beginTsipPacket(pParser, c);
+            }
+            break;
+        }
+        default:
+        {
+            pParser->state = TPS_WAITING_FOR_DLE;
+            break;
+        }
+    }
+
+    return false;
+}
+
+fixedPointW2F2_t tsipDilutionOfPrecision(const uint8_t* pData)
+{
+    const float dop = readBigEndianFloat(pData) * 100.0f + 0.5f;
+
+    if (!(dop >= 0.0f))
+    {
+        return 0;
+    }
+    return dop < 65535.0f ? (fixedPointW2F2_t) dop : 65535;
+}
+
+void decodeTsipAllInView(const uint8_t* pData, uint8_t dataLen, GpsData* pResult)
+{
+    GpgsaData* const pGpgsaData = &pResult->gpgsaData;
+    const uint8_t dimension = pData[TSIP_ALL_IN_VIEW_MODE] & TSIP_DIMENSION_MASK;
+    uint8_t prnsCount = dataLen - TSIP_ALL_IN_VIEW_PRNS;
+
+    // NMEA fix modes are 1 - no fix, 2 - 2D, 3 - 3D
+    if (dimension == TSIP_DIMENSION_3D)
+    {
+        pGpgsaData->fixMode = 3;
+    }
+    else if (dimension == TSIP_DIMENSION_2D)
+    {
+        pGpgsaData->fixMode = 2;
+    }
+    else
+    {
+        pGpgsaData->fixMode = 1;
+    }
+
+    pGpgsaData->pdop = tsipDilutionOfPrecision(pData + TSIP_ALL_IN_VIEW_PDOP);
+    pGpgsaData->hdop = tsipDilutionOfPrecision(pData + TSIP_ALL_IN_VIEW_HDOP);
+    pGpgsaData->vdop = tsipDilutionOfPrecision(pData + TSIP_ALL_IN_VIEW_VDOP);
+
+    if (prnsCount > GPGSA_MAX_USED_SATELLITES_COUNT)
+    {
+        prnsCount = GPGSA_MAX_USED_SATELLITES_COUNT;
+    }
+    memset(pGpgsaData->usedPrns, 0, sizeof(pGpgsaData->usedPrns));
+    memcpy(pGpgsaData->usedPrns, pData + TSIP_ALL_IN_VIEW_PRNS, prnsCount);
+}
+
+int32_t radiansToDegreesE7(double radians)
+{
+    const double degreesE7 = radians * (TSIP_DEGREES_PER_RADIAN * GPS_DEGREES_E7_PER_DEGREE);
+
+    if (!(degreesE7 > INT32_MIN && degreesE7 < INT32_MAX))
+    {
+        return INT32_MIN;
+    }
+    return (int32_t) (degreesE7 >= 0.0 ? degreesE7 + 0.5 : degreesE7 - 0.5);
+}
+
+bool decodeTsipPosition(const TsipReports* pReports, GpsData* pResult)
+{
+    const float timeOfFix = readBigEndianFloat(pReports->position + TSIP_POSITION_TIME_OF_FIX);
+
+    if (!pReports->hasPosition || !(timeOfFix >= 0.0f && timeOfFix < GPS_SECONDS_PER_WEEK))
+    {
+        return false;
+    }
+
+    GpggaData* const pGpggaData = &pResult->gpggaData;
+    const double altitudeMslMeters = readBigEndianDouble(pReports->position + TSIP_POSITION_ALTITUDE) * 10.0 + 0.5;
+
+    degreesE7ToAngularCoordinate(radiansToDegreesE7(readBigEndianDouble(pReports->position + TSIP_POSITION_LATITUDE)), true, &pGpggaData->latitude);
+    degreesE7ToAngularCoordinate(radiansToDegreesE7(readBigEndianDouble(pReports->position + TSIP_POSITION_LONGITUDE)), false, &pGpggaData->longitude);
+    // W5F1 meters can't go below sea level
+    if (altitudeMslMeters >= 1.0)
+    {
+        pGpggaData->altitudeMslMeters = altitudeMslMeters < 4294967295.0 ? (fixedPointW5F1_t) altitudeMslMeters : 4294967295U;
+    }
+    else
+    {
+        pGpggaData->altitudeMslMeters = 0;
+    }
+    pGpggaData->fixType = GPSFT_GPS;
+    if (pReports->allInViewLen != 0)
+    {
+        pGpggaData->numberOfSattelitesInUse = pReports->allInView[TSIP_ALL_IN_VIEW_MODE] >> 4;
+    }
+
+    if (pReports->hasGpsTime)
+    {
+        // time report is the current time which can already be in the next week
+        const float timeOfWeek = readBigEndianFloat(pReports->gpsTime);
+        const float utcOffset = readBigEndianFloat(pReports->gpsTime + TSIP_GPS_TIME_UTC_OFFSET);
+        uint16_t week = readBigEndianUint16(pReports->gpsTime + TSIP_GPS_TIME_WEEK);
+
+        if (timeOfWeek + TSIP_HALF_WEEK_SECONDS < timeOfFix)
+        {
+            --week;
+        }
+        else if (timeOfFix + TSIP_HALF_WEEK_SECONDS < timeOfWeek)
+        {
+            ++week;
+        }
+
+        // offset is 0 until receiver decodes it from the broadcast
+        gpsWeekTimeToUtc(week,
+                         (uint32_t) (timeOfFix * 100.0f + 0.5f),
+                         utcOffset >= 1.0f && utcOffset < 255.0f ? (uint8_t) (utcOffset + 0.5f) : GPS_UTC_LEAP_SECONDS,
+                         &pGpggaData->utcTime,
+                         &pResult->utcDate);
+    }
+    else
+    {
+        pGpggaData->utcTime.isValid = false;
+        pResult->utcDate.isValid = false;
+    }
+
+    return pGpggaData->latitude.isValid && pGpggaData->longitude.isValid;
+}
+
+void decodeTsipReports(const TsipReports* pReports, GpsData* pResult)
+{
+    if (pReports->allInViewLen != 0)
+    {
+        decodeTsipAllInView(pReports->allInView, pReports->allInViewLen, pResult);
+    }
+
+    if (decodeTsipPosition(pReports, pResult))
+    {
+        pResult->isValid = true;
+    }
+
+    if (pReports->hasVelocity)
+    {
+        horizontalVelocityToGpvtg(readBigEndianFloat(pReports->velocity + TSIP_VELOCITY_EAST),
+                                  readBigEndianFloat(pReports->velocity + TSIP_VELOCITY_NORTH),
+                                  &pResult->gpvtgData);
+    }
+}
+
+bool readTsipGpsData(TsipParser* pParser, GpsData* pResult)
+{
+    const uint32_t publishedCount = pParser->publishedCount;
+
+    if (publishedCount == pParser->readCount)
+    {
+        return false;
+    }
+
+    TsipReports reports;
+    pParser->readCount = publishedCount;
+    reports = pParser->publishedReports[pParser->publishedReportsIdx];
+
+    decodeTsipReports(&reports, pResult);
+
+    return true;
+}
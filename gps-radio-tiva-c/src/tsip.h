@@ -0,0 +1,98 @@
+#pragma once
+
+/*
+ * Trimble Standard Interface Protocol (Copernicus II).
+ *
+ * Packets are <DLE><id><data><DLE><ETX>, DLE bytes of the data are sent twice, multi-byte values are big endian.
+ * Packets are parsed byte by byte in UART receive interrupt, the latest position, velocity, time and satellite
+ * selection reports are published with satellite selection report (receiver sends it after every fix or once
+ * a second without one) and decoded by main loop with readTsipGpsData().
+ */
+
+#include "nmea_messages.h"
+
+#define TSIP_DLE                         0x10
+#define TSIP_ETX                         0x03
+
+#define TSIP_IO_OPTIONS_ID               0x35
+#define TSIP_GPS_TIME_ID                 0x41
+#define TSIP_IO_OPTIONS_REPORT_ID        0x55
+#define TSIP_ENU_VELOCITY_ID             0x56
+#define TSIP_ALL_IN_VIEW_ID              0x6D
+#define TSIP_DOUBLE_LLA_POSITION_ID      0x84
+
+#define TSIP_GPS_TIME_LEN                10
+#define TSIP_ENU_VELOCITY_LEN            20
+#define TSIP_ALL_IN_VIEW_MIN_LEN         17
+#define TSIP_ALL_IN_VIEW_MAX_LEN         (TSIP_ALL_IN_VIEW_MIN_LEN + 15) // up to 15 satellites
+#define TSIP_DOUBLE_LLA_POSITION_LEN     36
+#define TSIP_IO_OPTIONS_LEN              4
+
+// longer packets (superpackets, almanac, ...) are checked and skipped
+#define TSIP_MAX_DATA_LEN                TSIP_DOUBLE_LLA_POSITION_LEN
+
+// I/O options: double precision MSL LLA position (0x84), ENU velocity (0x56), GPS time, PPS always on,
+// no raw measurements, so automatic output is the reports below plus 0x46, 0x4B and 0x82 which can't be disabled
+#define TSIP_IO_OPTIONS_POSITION         0x16
+#define TSIP_IO_OPTIONS_VELOCITY         0x02
+#define TSIP_IO_OPTIONS_TIMING           0x00
+#define TSIP_IO_OPTIONS_AUXILIARY        0x00
+
+// port A configuration, NMEA input stays enabled so the sentence can be repeated
+#define TSIP_PORT_CONFIGURATION_SENTENCE "$PTNLSPT,004800,8,N,1,6,2*1E\r\n"
+
+// every data byte can be stuffed
+#define TSIP_IO_OPTIONS_PACKET_MAX_LEN   (2 * TSIP_IO_OPTIONS_LEN + 5)
+
+typedef enum TSIP_PACKET_STATE_t
+{
+    TPS_WAITING_FOR_DLE = 0,
+    TPS_ID,
+    TPS_DATA,
+    TPS_DATA_DLE,         // DLE in data, next one is either stuffed DLE or ETX
+} TSIP_PACKET_STATE;
+
+/*
+ * Reports are kept as received, decoding floating point values is left to main loop
+ */
+typedef struct TsipReports_t
+{
+    bool hasGpsTime;
+    bool hasPosition;
+    bool hasVelocity;
+    uint8_t allInViewLen; // 0 if not received
+    uint8_t gpsTime[TSIP_GPS_TIME_LEN];
+    uint8_t position[TSIP_DOUBLE_LLA_POSITION_LEN];
+    uint8_t velocity[TSIP_ENU_VELOCITY_LEN];
+    uint8_t allInView[TSIP_ALL_IN_VIEW_MAX_LEN];
+} TsipReports;
+
+typedef struct TsipParser_t
+{
+    TSIP_PACKET_STATE state;
+    uint8_t id;
+    uint8_t dataLen;
+    bool isTooLong;
+    uint8_t data[TSIP_MAX_DATA_LEN];
+    TsipReports reports;              // owned by the interrupt handler
+
+    // reports are published to the slot which isn't being read, fixes come once a second
+    TsipReports publishedReports[2];
+    volatile uint8_t publishedReportsIdx;
+    volatile uint32_t publishedCount;
+    uint32_t readCount;
+
+    volatile bool isTsipOutputConfirmed; // receiver reported I/O options
+    volatile uint32_t rejectedCount;     // packets with broken framing
+} TsipParser;
+
+void initializeTsipParser(TsipParser* pParser);
+
+// to be called from UART receive interrupt, returns true at the end of packet
+bool parseTsipByte(TsipParser* pParser, uint8_t c);
+
+// to be called from main loop, returns false if nothing was published since the last call
+bool readTsipGpsData(TsipParser* pParser, GpsData* pResult);
+
+// I/O options command which selects the reports decoded by readTsipGpsData(), returns its length
+uint8_t createTsipIoOptionsPacket(uint8_t* pPacket);
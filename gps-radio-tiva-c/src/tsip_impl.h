@@ -0,0 +1,55 @@
+#pragma once
+
+#include "tsip.h"
+#include "gps_conversions.h"
+
+// offsets of report fields in packet data (after id)
+#define TSIP_GPS_TIME_WEEK               4  // extended week number
+#define TSIP_GPS_TIME_UTC_OFFSET         6  // seconds, 0 if not known yet
+
+#define TSIP_POSITION_LATITUDE           0  // radians
+#define TSIP_POSITION_LONGITUDE          8
+#define TSIP_POSITION_ALTITUDE           16 // meters
+#define TSIP_POSITION_TIME_OF_FIX        32 // seconds of GPS week, negative if fix wasn't computed by receiver
+
+#define TSIP_VELOCITY_EAST               0  // m/s
+#define TSIP_VELOCITY_NORTH              4
+
+#define TSIP_ALL_IN_VIEW_MODE            0  // dimension in bits 0-2, satellites count in bits 4-7
+#define TSIP_ALL_IN_VIEW_PDOP            1
+#define TSIP_ALL_IN_VIEW_HDOP            5
+#define TSIP_ALL_IN_VIEW_VDOP            9
+#define TSIP_ALL_IN_VIEW_PRNS            17
+
+#define TSIP_DIMENSION_MASK              0x07
+#define TSIP_DIMENSION_2D                3
+#define TSIP_DIMENSION_3D                4
+
+#define TSIP_DEGREES_PER_RADIAN          (180.0 / 3.1415926535898) // PI as defined by ICD-GPS-200
+
+// DLE is followed by another one, returns new packet length
+uint8_t appendStuffedTsipByte(uint8_t* pPacket, uint8_t packetLen, uint8_t c);
+
+// writes packet with stuffed DLE bytes, returns packet length
+uint8_t createTsipPacket(uint8_t id, const uint8_t* pData, uint8_t dataLen, uint8_t* pPacket);
+
+// returns false so it can end byte parsing
+bool rejectTsipPacket(TsipParser* pParser);
+
+void beginTsipPacket(TsipParser* pParser, uint8_t id);
+// data over TSIP_MAX_DATA_LEN marks packet as too long
+void appendTsipData(TsipParser* pParser, uint8_t c);
+
+// packet ended with DLE ETX (interrupt)
+void completeTsipPacket(TsipParser* pParser);
+
+// DOP to W2F2 rounded and saturated
+fixedPointW2F2_t tsipDilutionOfPrecision(const uint8_t* pData);
+
+// out of range values become INT32_MIN which isn't valid coordinate
+int32_t radiansToDegreesE7(double radians);
+
+void decodeTsipAllInView(const uint8_t* pData, uint8_t dataLen, GpsData* pResult);
+// returns false if position wasn't computed by receiver
+bool decodeTsipPosition(const TsipReports* pReports, GpsData* pResult);
+void decodeTsipReports(const TsipReports* pReports, GpsData* pResult);
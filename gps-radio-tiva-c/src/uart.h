@@ -9,7 +9,9 @@
     #define UART_NUMBER_OF_CHANNELS 2
 #endif
 
-#define UART_READ_BUFFER_MAX_MESSAGES_LEN 3
+// received messages share character ring, both lengths have to be powers of two
+#define UART_READ_BUFFER_MAX_MESSAGES_LEN 16
+#define UART_READ_BUFFER_MAX_CHARS_LEN    512
 #define UART_WRITE_BUFFER_MAX_CHARS_LEN   512
 #define UART_MESSAGE_MAX_LEN              255
 
@@ -30,17 +32,53 @@ typedef struct Message_t
 #define UART_FLAGS_RECEIVE 0x01
 #define UART_FLAGS_SEND    0x02
 
+// first latency histogram bucket takes everything below 2^6 us, each next one doubles, last one takes the rest
+#define UART_LATENCY_HISTOGRAM_LEN      20
+#define UART_LATENCY_HISTOGRAM_MIN_LOG2 6
+
+typedef enum UART_DROP_REASON_t
+{
+    UDR_TOO_LONG        = 0, // longer than UART_MESSAGE_MAX_LEN
+    UDR_CHARACTERS_FULL = 1, // no space left in character ring
+    UDR_MESSAGES_FULL   = 2, // all message descriptors taken
+    UDR_COUNT
+} UART_DROP_REASON;
+
+// Per channel counters since start (diagnostics), all of them wrap around
+typedef struct UartHealth_t
+{
+    uint32_t receivedCharsCount;
+    uint32_t receivedMessagesCount;                        // published to message buffer
+    uint32_t skippedCharsCount;                            // outside of messages, rest of dropped ones included
+    uint32_t droppedMessagesCount[UDR_COUNT];
+    uint32_t overrunErrorsCount;                           // receive status, at most one per interrupt
+    uint32_t framingErrorsCount;
+    uint32_t rejectedWritesCount;                          // write buffer full
+    uint32_t latencyHistogram[UART_LATENCY_HISTOGRAM_LEN]; // from '$' to message release
+} UartHealth;
+
 void initializeUart(void);
+bool getUartHealth(uint8_t channel, UartHealth* pHealth);
 bool initializeUartChannel(uint8_t channel,
                            uint8_t uartPort,
                            uint32_t baudRate,
                            uint32_t cpuSpeedHz,
                            uint32_t flags);
 
+// received characters are handed to the callback from UART interrupt one by one, nothing is buffered
+// for the channel (binary protocols and streaming NMEA parser use it)
+typedef void (*UartReadCallback)(void* pContext, uint8_t character);
+
+bool setUartReadCallback(uint8_t channel, UartReadCallback callback, void* pContext);
+
 // those functions should be used from main 'thread' only
 // if you use them from other interrupts (higher priority than UART ones
 // behaviour is undefined).
-bool readMessage(uint8_t channel, Message* pResultBuffer);
+#ifndef NMEA_STREAMING_PARSER
+// oldest received message is handed out in place (it stays in channel's ring), it is valid until released
+bool peekMessage(uint8_t channel, const Message** ppMessage);
+void releaseMessage(uint8_t channel);
+#endif
 
 bool write(uint8_t channel, uint8_t character);
 bool writeString(uint8_t channel, char* szData);
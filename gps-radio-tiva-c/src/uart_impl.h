@@ -6,6 +6,13 @@
 #include <driverlib/uart.h>
 #include <driverlib/rom_map.h>
 #include <driverlib/interrupt.h>
+#if defined(UART_DMA_RECEIVE) || defined(UART_DMA_TRANSMIT)
+    #include <driverlib/udma.h>
+
+    // uDMA completion is signalled on UART interrupt and stays pending until channel's DMACHIS bit is cleared,
+    // channel assignment is kept above the channel number
+    #define UARTDmaChannelIntMask(channel) (1UL << ((channel) & 0x1F))
+#endif
 
 #define UARTTxInterruptEnable(pChannelData) MAP_UARTIntEnable((pChannelData)->base, UART_INT_TX)
 #define UARTTxInterruptDisable(pChannelData) MAP_UARTIntDisable((pChannelData)->base, UART_INT_TX)
@@ -16,16 +23,99 @@
 #define UARTCharactersAvailable(pChannelData) MAP_UARTCharsAvail((pChannelData)->base)
 #define UARTGetCharNonBlocking(pChannelData) MAP_UARTCharGetNonBlocking((pChannelData)->base)
 
+#if (UART_READ_BUFFER_MAX_CHARS_LEN & (UART_READ_BUFFER_MAX_CHARS_LEN - 1)) != 0 || \
+    (UART_READ_BUFFER_MAX_MESSAGES_LEN & (UART_READ_BUFFER_MAX_MESSAGES_LEN - 1)) != 0 || \
+    UART_READ_BUFFER_MAX_MESSAGES_LEN > 128
+    #error read buffer lengths have to be powers of two
+#endif
+
+#if UART_READ_BUFFER_MAX_CHARS_LEN < 2 * (UART_MESSAGE_MAX_LEN + 1)
+    #error read buffer has to fit message relocated to its start next to the original one
+#endif
+
+// writes to the buffer have to complete before index which publishes them (and reads before index which releases
+// them), UART interrupt and main 'thread' run on the same core so it only keeps compiler and CPU from reordering
+#if defined(rvmdk)
+    #define UARTMemoryBarrier() __dmb(0xF)
+#elif defined(__GNUC__)
+    #define UARTMemoryBarrier() __sync_synchronize()
+#else
+    #define UARTMemoryBarrier()
+#endif
+
+#ifdef UART_DMA_RECEIVE
+    // uDMA moves characters in bursts of UART_DMA_RECEIVE_BURST_LEN (RX FIFO trigger level), anything below that
+    // stays in FIFO until receive timeout interrupt
+    #define UART_DMA_RECEIVE_BLOCK_LEN 64
+    #define UART_DMA_RECEIVE_BURST_LEN 8
+
+    #if (UART_DMA_RECEIVE_BLOCK_LEN % UART_DMA_RECEIVE_BURST_LEN) != 0 || UART_DMA_RECEIVE_BLOCK_LEN > 255
+        #error receive block has to be made of whole bursts
+    #endif
+
+    #define UARTDmaReceiveBlockSelect(blockIdx) ((blockIdx) == 0 ? UDMA_PRI_SELECT : UDMA_ALT_SELECT)
+    #define UARTIsDmaReceiveEnabled(pChannelData) ((pChannelData)->dmaReceiveBuffer.isEnabled)
+#else
+    #define UARTIsDmaReceiveEnabled(pChannelData) false
+#endif
+
+#ifdef UART_DMA_TRANSMIT
+    #define UARTIsDmaTransmitEnabled(pChannelData) ((pChannelData)->dmaTransmit.isEnabled)
+#else
+    #define UARTIsDmaTransmitEnabled(pChannelData) false
+#endif
+
+#define UARTReadBufferCharIdx(idx) ((idx) & (UART_READ_BUFFER_MAX_CHARS_LEN - 1))
+#define UARTReadBufferMessageIdx(idx) ((idx) & (UART_READ_BUFFER_MAX_MESSAGES_LEN - 1))
+
+typedef struct MessageDescriptor_t
+{
+    uint16_t startIdx;   // free running index of the record (size byte)
+    uint32_t startTicks; // '$' arrival
+} MessageDescriptor;
+
+/*
+ * Single producer (UART interrupt) single consumer (main 'thread') ring of messages. Indices are free running and
+ * wrap around naturally, each side writes only its own ones.
+ *
+ * Characters from '$' to LF go into the character ring as they arrive, message is published with descriptor at
+ * LF. Message which doesn't fit (ring, descriptors or UART_MESSAGE_MAX_LEN) is dropped on its own and receiving
+ * resumes with the next '$'.
+ *
+ * Each message is stored as a record laid out like Message (size byte followed by characters) so it can be parsed
+ * in place. Record is never split by the end of the ring, the one which would be is moved to the ring start while
+ * it is being received.
+ */
 typedef struct ReadBuffer_t
 {
-    bool isFull;
-    bool waitUntilNextMessage;
-    bool previousCharWasCR;
-    uint8_t startIdx;
-    uint8_t endIdx;
-    Message buffer[UART_READ_BUFFER_MAX_MESSAGES_LEN];
+    // consumer
+    volatile uint16_t charsStartIdx;
+    volatile uint8_t messagesStartIdx;
+    // producer
+    volatile uint8_t messagesEndIdx;
+    uint16_t messageStartIdx;  // record of message being received
+    uint16_t messageEndIdx;
+    uint32_t messageStartTicks;
+    bool isReceivingMessage;
+    MessageDescriptor messages[UART_READ_BUFFER_MAX_MESSAGES_LEN];
+    uint8_t chars[UART_READ_BUFFER_MAX_CHARS_LEN];
 } ReadBuffer;
 
+#ifdef UART_DMA_RECEIVE
+/*
+ * uDMA fills primary and alternate block in ping-pong mode, UART interrupt hands characters of filled block (or of
+ * partially filled one on receive timeout) over exactly as if they were read from FIFO one by one.
+ */
+typedef struct DmaReceiveBuffer_t
+{
+    bool isEnabled;
+    uint32_t channel;
+    uint8_t activeBlockIdx;      // block uDMA writes to now
+    uint8_t processedCharsCount; // characters of active block handed over already
+    uint8_t blocks[2][UART_DMA_RECEIVE_BLOCK_LEN];
+} DmaReceiveBuffer;
+#endif
+
 typedef struct WriteBuffer_t
 {
     bool isEmpty;
@@ -34,15 +124,42 @@ typedef struct WriteBuffer_t
     uint8_t buffer[UART_WRITE_BUFFER_MAX_CHARS_LEN];
 } WriteBuffer;
 
+#ifdef UART_DMA_TRANSMIT
+// uDMA sends contiguous span of write buffer which starts at its start index, index moves when the span is done
+typedef struct DmaTransmit_t
+{
+    bool isEnabled;
+    uint32_t channel;
+    uint16_t transferSize; // 0 when uDMA is idle
+} DmaTransmit;
+#endif
+
 typedef struct UartChannelData_t
 {
     uint32_t base;
     uint32_t interruptId;
+    volatile UartReadCallback readCallback;
+    void* pReadCallbackContext;
+#ifndef NMEA_STREAMING_PARSER
     ReadBuffer readBuffer;
+#endif
+#ifdef UART_DMA_RECEIVE
+    DmaReceiveBuffer dmaReceiveBuffer;
+#endif
     WriteBuffer writeBuffer;
+#ifdef UART_DMA_TRANSMIT
+    DmaTransmit dmaTransmit;
+#endif
+    UartHealth health;
 } UartChannelData;
 
 void uartReadIntHandler(UartChannelData* pChannelData);
+#ifdef UART_DMA_RECEIVE
+void startDmaReceive(UartChannelData* pChannelData);
+#endif
 void uartWriteIntHandler(UartChannelData* pChannelData);
+#ifdef UART_DMA_TRANSMIT
+void startDmaTransmit(UartChannelData* pChannelData);
+#endif
 
 extern UartChannelData uartChannelData[UART_NUMBER_OF_CHANNELS];
@@ -12,14 +12,50 @@
 #include <driverlib/sysctl.h>
 #include <driverlib/pin_map.h>
 #include <driverlib/rom_map.h>
+#if defined(UART_DMA_RECEIVE) || defined(UART_DMA_TRANSMIT)
+    #include <driverlib/udma.h>
+#endif
 
 UartChannelData uartChannelData[UART_NUMBER_OF_CHANNELS];
 UartChannelData* uart2UartChannelData[UART_COUNT];
 
+#if defined(UART_DMA_RECEIVE) || defined(UART_DMA_TRANSMIT)
+    // uDMA channel control structures (primary and alternate ones), table has to be aligned to its size
+    static tDMAControlTable uartDmaControlTable[64] __attribute__((aligned(1024)));
+#endif
+
+#ifdef UART_DMA_RECEIVE
+    static const uint32_t uartDmaReceiveChannels[UART_COUNT] =
+    {
+        UDMA_CH8_UART0RX,
+        UDMA_CH22_UART1RX,
+        UDMA_CH12_UART2RX,
+        UDMA_CH16_UART3RX,
+        UDMA_CH18_UART4RX
+    };
+#endif
+
+#ifdef UART_DMA_TRANSMIT
+    static const uint32_t uartDmaTransmitChannels[UART_COUNT] =
+    {
+        UDMA_CH9_UART0TX,
+        UDMA_CH23_UART1TX,
+        UDMA_CH13_UART2TX,
+        UDMA_CH17_UART3TX,
+        UDMA_CH19_UART4TX
+    };
+#endif
+
 void initializeUart(void)
 {
     memset(uartChannelData, 0, sizeof(uartChannelData));
     memset(uart2UartChannelData, 0, sizeof(uart2UartChannelData));
+
+#if defined(UART_DMA_RECEIVE) || defined(UART_DMA_TRANSMIT)
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    MAP_uDMAEnable();
+    MAP_uDMAControlBaseSet(uartDmaControlTable);
+#endif
 }
 
 bool initializeUartChannel(uint8_t channel,
@@ -131,17 +167,29 @@ bool initializeUartChannel(uint8_t channel,
                             cpuSpeedHz,
                             baudRate, 
                             (UART_CONFIG_PAR_NONE | UART_CONFIG_STOP_ONE | UART_CONFIG_WLEN_8));
+#ifdef UART_DMA_RECEIVE
+    // receive FIFO trigger level is uDMA burst size
+    MAP_UARTFIFOLevelSet(uartBase, UART_FIFO_TX1_8, UART_FIFO_RX4_8);
+#else
     MAP_UARTFIFOLevelSet(uartBase, UART_FIFO_TX1_8, UART_FIFO_RX1_8);
+#endif
     MAP_UARTIntDisable(uartBase, 0xFFFFFFFF);
 
     if (flags & UART_FLAGS_RECEIVE)
     {
+#ifdef UART_DMA_RECEIVE
+        // uDMA takes characters from FIFO, receive timeout picks up the rest
+        MAP_UARTIntEnable(uartBase, UART_INT_RT);
+#else
         MAP_UARTIntEnable(uartBase, UART_INT_RX | UART_INT_RT);
+#endif
     }
+#ifndef UART_DMA_TRANSMIT
     if (flags & UART_FLAGS_SEND)
     {
         MAP_UARTIntEnable(uartBase, UART_INT_TX);
     }
+#endif
 
     MAP_UARTEnable(uartBase);
     // UART interrupt has lower priority than I2C and PWM because of the FIFO
@@ -151,6 +199,22 @@ bool initializeUartChannel(uint8_t channel,
     uartChannelData[channel].base = uartBase;
     uartChannelData[channel].interruptId = uartInterruptId;
     uartChannelData[channel].writeBuffer.isEmpty = true;
+#ifdef UART_DMA_RECEIVE
+    if (flags & UART_FLAGS_RECEIVE)
+    {
+        uartChannelData[channel].dmaReceiveBuffer.isEnabled = true;
+        uartChannelData[channel].dmaReceiveBuffer.channel = uartDmaReceiveChannels[uartPort];
+        startDmaReceive(&uartChannelData[channel]);
+    }
+#endif
+#ifdef UART_DMA_TRANSMIT
+    if (flags & UART_FLAGS_SEND)
+    {
+        uartChannelData[channel].dmaTransmit.isEnabled = true;
+        uartChannelData[channel].dmaTransmit.channel = uartDmaTransmitChannels[uartPort];
+        startDmaTransmit(&uartChannelData[channel]);
+    }
+#endif
     uart2UartChannelData[uartPort] = &uartChannelData[channel];
 
     return true;
@@ -164,11 +228,11 @@ void Uart0IntHandler(void)
         const uint32_t status = MAP_UARTIntStatus(pChannelData->base, true);
         MAP_UARTIntClear(pChannelData->base, status);
 
-        if (status & (UART_INT_RX | UART_INT_RT))
+        if ((status & (UART_INT_RX | UART_INT_RT)) || UARTIsDmaReceiveEnabled(pChannelData))
         {
             uartReadIntHandler(pChannelData);
         }
-        if (status & UART_INT_TX)
+        if ((status & UART_INT_TX) || UARTIsDmaTransmitEnabled(pChannelData))
         {
             uartWriteIntHandler(pChannelData);
         }
@@ -183,11 +247,11 @@ void Uart1IntHandler(void)
         const uint32_t status = MAP_UARTIntStatus(pChannelData->base, true);
         MAP_UARTIntClear(pChannelData->base, status);
 
-        if (status & (UART_INT_RX | UART_INT_RT))
+        if ((status & (UART_INT_RX | UART_INT_RT)) || UARTIsDmaReceiveEnabled(pChannelData))
         {
             uartReadIntHandler(pChannelData);
         }
-        if (status & UART_INT_TX)
+        if ((status & UART_INT_TX) || UARTIsDmaTransmitEnabled(pChannelData))
         {
             uartWriteIntHandler(pChannelData);
         }
@@ -202,11 +266,11 @@ void Uart2IntHandler(void)
         const uint32_t status = MAP_UARTIntStatus(pChannelData->base, true);
         MAP_UARTIntClear(pChannelData->base, status);
 
-        if (status & (UART_INT_RX | UART_INT_RT))
+        if ((status & (UART_INT_RX | UART_INT_RT)) || UARTIsDmaReceiveEnabled(pChannelData))
         {
             uartReadIntHandler(pChannelData);
         }
-        if (status & UART_INT_TX)
+        if ((status & UART_INT_TX) || UARTIsDmaTransmitEnabled(pChannelData))
         {
             uartWriteIntHandler(pChannelData);
         }
@@ -221,11 +285,11 @@ void Uart3IntHandler(void)
         const uint32_t status = MAP_UARTIntStatus(pChannelData->base, true);
         MAP_UARTIntClear(pChannelData->base, status);
 
-        if (status & (UART_INT_RX | UART_INT_RT))
+        if ((status & (UART_INT_RX | UART_INT_RT)) || UARTIsDmaReceiveEnabled(pChannelData))
         {
             uartReadIntHandler(pChannelData);
         }
-        if (status & UART_INT_TX)
+        if ((status & UART_INT_TX) || UARTIsDmaTransmitEnabled(pChannelData))
         {
             uartWriteIntHandler(pChannelData);
         }
@@ -240,11 +304,11 @@ void Uart4IntHandler(void)
         const uint32_t status = MAP_UARTIntStatus(pChannelData->base, true);
         MAP_UARTIntClear(pChannelData->base, status);
 
-        if (status & (UART_INT_RX | UART_INT_RT))
+        if ((status & (UART_INT_RX | UART_INT_RT)) || UARTIsDmaReceiveEnabled(pChannelData))
         {
             uartReadIntHandler(pChannelData);
         }
-        if (status & UART_INT_TX)
+        if ((status & UART_INT_TX) || UARTIsDmaTransmitEnabled(pChannelData))
         {
             uartWriteIntHandler(pChannelData);
         }
@@ -1,125 +1,349 @@
 #include "uart.h"
 #include "uart_impl.h"
+#include "timer.h"
 
 #include <string.h>
 
-uint8_t advanceUint8Index(uint8_t currentValue, uint8_t maxLen)
+#ifdef UART_DMA_RECEIVE
+    #include <inc/hw_uart.h>
+#endif
+
+bool setUartReadCallback(uint8_t channel, UartReadCallback callback, void* pContext)
 {
-    ++currentValue;
-    if (currentValue >= maxLen)
+    if (channel >= UART_NUMBER_OF_CHANNELS)
     {
-        currentValue = 0;
+        return false;
     }
-    return currentValue;
+
+    UartChannelData* const pChannelData = &uartChannelData[channel];
+
+    // context goes first so interrupt never sees new callback with old context
+    pChannelData->readCallback = 0;
+    pChannelData->pReadCallbackContext = pContext;
+    pChannelData->readCallback = callback;
+
+    return true;
 }
 
-bool readMessage(uint8_t channel, Message* pResultBuffer)
+bool getUartHealth(uint8_t channel, UartHealth* pHealth)
 {
-    if (!pResultBuffer)
+    if (channel >= UART_NUMBER_OF_CHANNELS || !pHealth)
     {
         return false;
     }
-    
-    UartChannelData* const pChannelData = &uartChannelData[channel];
 
-    // if buffer is empty and interrupt kicks in after we check '!pChannelData->readBuffer.isFull' we are still fine
-    // as buffer can only get fuller by interrupt
-    if (!pChannelData->readBuffer.isFull && pChannelData->readBuffer.endIdx == pChannelData->readBuffer.startIdx)
+    // counters are updated one by one, copy isn't consistent snapshot of all of them
+    memcpy(pHealth, &uartChannelData[channel].health, sizeof(UartHealth));
+
+    return true;
+}
+
+#ifndef NMEA_STREAMING_PARSER
+
+void recordMessageLatency(UartHealth* pHealth, uint32_t ticks)
+{
+    uint32_t microseconds = timerTicksToMicroseconds(ticks) >> UART_LATENCY_HISTOGRAM_MIN_LOG2;
+    uint8_t bucketIdx = 0;
+
+    while (microseconds != 0 && bucketIdx < UART_LATENCY_HISTOGRAM_LEN - 1)
+    {
+        microseconds >>= 1;
+        ++bucketIdx;
+    }
+    ++pHealth->latencyHistogram[bucketIdx];
+}
+
+bool peekMessage(uint8_t channel, const Message** ppMessage)
+{
+    if (!ppMessage)
     {
         return false;
     }
 
-    // start index can only be changed by 'thread' other than UART interrupt handler
-    // so we fine here as well
-    memcpy(pResultBuffer, &pChannelData->readBuffer.buffer[pChannelData->readBuffer.startIdx], sizeof(Message));
-    pChannelData->readBuffer.buffer[pChannelData->readBuffer.startIdx].size = 0;
-    pChannelData->readBuffer.startIdx = advanceUint8Index(pChannelData->readBuffer.startIdx, UART_READ_BUFFER_MAX_MESSAGES_LEN);
+    ReadBuffer* const pReadBuffer = &uartChannelData[channel].readBuffer;
+    const uint8_t messagesStartIdx = pReadBuffer->messagesStartIdx;
+
+    if (messagesStartIdx == pReadBuffer->messagesEndIdx)
+    {
+        return false;
+    }
 
-    return pResultBuffer->size > 0;
+    // descriptor and characters were written before end index was published
+    UARTMemoryBarrier();
+
+    // record has the same layout as Message and is never split by the end of the ring, only size + 1 bytes of it
+    // are there though
+    const uint16_t startIdx = pReadBuffer->messages[UARTReadBufferMessageIdx(messagesStartIdx)].startIdx;
+    *ppMessage = (const Message*) &pReadBuffer->chars[UARTReadBufferCharIdx(startIdx)];
+
+    return true;
 }
 
-void uartReadIntHandler(UartChannelData* pChannelData)
+void releaseMessage(uint8_t channel)
 {
-    int32_t encodedChar;
-    uint8_t decodedChar;
+    ReadBuffer* const pReadBuffer = &uartChannelData[channel].readBuffer;
+    const uint8_t messagesStartIdx = pReadBuffer->messagesStartIdx;
+
+    if (messagesStartIdx == pReadBuffer->messagesEndIdx)
+    {
+        return;
+    }
+
+    UARTMemoryBarrier();
+
+    const MessageDescriptor descriptor = pReadBuffer->messages[UARTReadBufferMessageIdx(messagesStartIdx)];
+    const uint8_t size = pReadBuffer->chars[UARTReadBufferCharIdx(descriptor.startIdx)];
+
+    // caller is done with the characters before interrupt can reuse them
+    UARTMemoryBarrier();
+
+    pReadBuffer->charsStartIdx = descriptor.startIdx + 1 + size;
+    pReadBuffer->messagesStartIdx = messagesStartIdx + 1;
+
+    recordMessageLatency(&uartChannelData[channel].health, getTimerTicks() - descriptor.startTicks);
+}
+
+void dropReceivedMessage(UartChannelData* pChannelData, UART_DROP_REASON reason)
+{
+    ReadBuffer* const pReadBuffer = &pChannelData->readBuffer;
+
+    pReadBuffer->isReceivingMessage = false;
+    pReadBuffer->messageEndIdx = pReadBuffer->messageStartIdx;
+    ++pChannelData->health.droppedMessagesCount[reason];
+}
+
+bool relocateReceivedMessage(ReadBuffer* pReadBuffer)
+{
+    // part of the record received so far moves from the end of the ring to its start, characters it skips are
+    // freed together with the message
+    const uint16_t recordSize = pReadBuffer->messageEndIdx - pReadBuffer->messageStartIdx;
+    const uint16_t startIdx = pReadBuffer->messageEndIdx;
+
+    if ((uint16_t) (startIdx + recordSize - pReadBuffer->charsStartIdx) >= UART_READ_BUFFER_MAX_CHARS_LEN)
+    {
+        return false;
+    }
+
+    memcpy(pReadBuffer->chars, &pReadBuffer->chars[UARTReadBufferCharIdx(pReadBuffer->messageStartIdx)], recordSize);
+    pReadBuffer->messageStartIdx = startIdx;
+    pReadBuffer->messageEndIdx = startIdx + recordSize;
+
+    return true;
+}
+
+void receiveMessageCharacter(UartChannelData* pChannelData, uint8_t c)
+{
+    ReadBuffer* const pReadBuffer = &pChannelData->readBuffer;
+
+    if (c == '$')
+    {
+        // start of message, unfinished one is overwritten, first byte of the record is left for size
+        pReadBuffer->isReceivingMessage = true;
+        pReadBuffer->messageEndIdx = pReadBuffer->messageStartIdx + 1;
+        pReadBuffer->messageStartTicks = getTimerTicks();
+    }
+    else if (!pReadBuffer->isReceivingMessage)
+    {
+        ++pChannelData->health.skippedCharsCount;
+        return;
+    }
+
+    // record would wrap around the end of the ring (at most once per round of the ring)
+    if (UARTReadBufferCharIdx(pReadBuffer->messageEndIdx) == 0 && !relocateReceivedMessage(pReadBuffer))
+    {
+        dropReceivedMessage(pChannelData, UDR_CHARACTERS_FULL);
+        return;
+    }
+
+    const uint16_t messageSize = pReadBuffer->messageEndIdx - pReadBuffer->messageStartIdx - 1;
+    const uint16_t usedCharsCount = pReadBuffer->messageEndIdx - pReadBuffer->charsStartIdx;
+
+    if (messageSize >= UART_MESSAGE_MAX_LEN)
+    {
+        dropReceivedMessage(pChannelData, UDR_TOO_LONG);
+        return;
+    }
+    if (usedCharsCount >= UART_READ_BUFFER_MAX_CHARS_LEN)
+    {
+        dropReceivedMessage(pChannelData, UDR_CHARACTERS_FULL);
+        return;
+    }
+
+    pReadBuffer->chars[UARTReadBufferCharIdx(pReadBuffer->messageEndIdx)] = c;
+    ++pReadBuffer->messageEndIdx;
+
+    if (c != '\x0A')
+    {
+        return;
+    }
 
+    const uint8_t messagesEndIdx = pReadBuffer->messagesEndIdx;
+    if ((uint8_t) (messagesEndIdx - pReadBuffer->messagesStartIdx) >= UART_READ_BUFFER_MAX_MESSAGES_LEN)
+    {
+        dropReceivedMessage(pChannelData, UDR_MESSAGES_FULL);
+        return;
+    }
+
+    MessageDescriptor* const pDescriptor = &pReadBuffer->messages[UARTReadBufferMessageIdx(messagesEndIdx)];
+    pReadBuffer->chars[UARTReadBufferCharIdx(pReadBuffer->messageStartIdx)] = (uint8_t) (messageSize + 1);
+    pDescriptor->startIdx = pReadBuffer->messageStartIdx;
+    pDescriptor->startTicks = pReadBuffer->messageStartTicks;
+
+    // message has to be complete before it is published
+    UARTMemoryBarrier();
+    pReadBuffer->messagesEndIdx = messagesEndIdx + 1;
+    ++pChannelData->health.receivedMessagesCount;
+
+    pReadBuffer->messageStartIdx = pReadBuffer->messageEndIdx;
+    pReadBuffer->isReceivingMessage = false;
+}
+
+#endif
+
+void receiveCharacter(UartChannelData* pChannelData, uint8_t c)
+{
+    ++pChannelData->health.receivedCharsCount;
+
+    if (pChannelData->readCallback)
+    {
+        // channel doesn't use message buffer
+        pChannelData->readCallback(pChannelData->pReadCallbackContext, c);
+    }
+#ifndef NMEA_STREAMING_PARSER
+    else
+    {
+        receiveMessageCharacter(pChannelData, c);
+    }
+#endif
+}
+
+void receiveFifoCharacters(UartChannelData* pChannelData)
+{
     while(UARTCharactersAvailable(pChannelData))
     {
-        encodedChar = UARTGetCharNonBlocking(pChannelData);
-        decodedChar = (uint8_t) (encodedChar & 0xFF);
-
-        if (pChannelData->readBuffer.isFull && pChannelData->readBuffer.startIdx != pChannelData->readBuffer.endIdx)
-        {
-            // other 'thread' advanced start index (doesn't matter much if we miss this event and think that buffer is
-            // full for the next iteration)
-            pChannelData->readBuffer.isFull = false;
-        }
-
-        if (!pChannelData->readBuffer.isFull && !pChannelData->readBuffer.waitUntilNextMessage)
-        {
-            const uint8_t charWriteIdx = pChannelData->readBuffer.buffer[pChannelData->readBuffer.endIdx].size;
-            const bool thereIsSpaceForNewCharacter = charWriteIdx < UART_MESSAGE_MAX_LEN;
-
-            bool moveToNewMessage = false;
-            bool placeCurrentCharToNewMessage = false;
-            
-            if (!thereIsSpaceForNewCharacter)
-            {
-                moveToNewMessage = true;
-                pChannelData->readBuffer.waitUntilNextMessage = true; // message buffer overflow, skip until next message
-            }
-            else if (decodedChar == '$' && charWriteIdx != 0)
-            {
-                moveToNewMessage = true;
-                placeCurrentCharToNewMessage = true;
-                pChannelData->readBuffer.waitUntilNextMessage = false; // we already at the beginning of next message
-            }                
-            else
-            {
-                pChannelData->readBuffer.buffer[pChannelData->readBuffer.endIdx].message[charWriteIdx] = decodedChar;
-                ++pChannelData->readBuffer.buffer[pChannelData->readBuffer.endIdx].size;
-            }
-            
-            if (moveToNewMessage)
-            {
-                // start index can only get away and cannot get past end index so we are fine here
-                pChannelData->readBuffer.endIdx = advanceUint8Index(pChannelData->readBuffer.endIdx, UART_READ_BUFFER_MAX_MESSAGES_LEN);
-                // if start index moves on we are golden and can continue writing
-                if (pChannelData->readBuffer.endIdx == pChannelData->readBuffer.startIdx)
-                {
-                    pChannelData->readBuffer.isFull = true;
-                }
-                else
-                {
-                    if (placeCurrentCharToNewMessage)
-                    {
-                        pChannelData->readBuffer.buffer[pChannelData->readBuffer.endIdx].message[0] = decodedChar;
-                        pChannelData->readBuffer.buffer[pChannelData->readBuffer.endIdx].size = 1;
-                    }
-                    else
-                    {
-                        pChannelData->readBuffer.buffer[pChannelData->readBuffer.endIdx].size = 0;
-                    }
-                }
-            }
-        }
-        else
-        {
-            // put some code below to test full buffer scenarios
-        }
-
-        if (pChannelData->readBuffer.waitUntilNextMessage && (pChannelData->readBuffer.previousCharWasCR && decodedChar == '\x0A'))
-        {
-            pChannelData->readBuffer.waitUntilNextMessage = false;
-        }
-
-        if (decodedChar == '\x0D')
-        {
-            pChannelData->readBuffer.previousCharWasCR = true;
-        }
-        else
-        {
-            pChannelData->readBuffer.previousCharWasCR = false;
-        }
+        receiveCharacter(pChannelData, (uint8_t) (UARTGetCharNonBlocking(pChannelData) & 0xFF));
+    }
+}
+
+#ifdef UART_DMA_RECEIVE
+
+void armDmaReceiveBlock(UartChannelData* pChannelData, uint8_t blockIdx)
+{
+    DmaReceiveBuffer* const pDmaReceiveBuffer = &pChannelData->dmaReceiveBuffer;
+
+    MAP_uDMAChannelTransferSet(pDmaReceiveBuffer->channel | UARTDmaReceiveBlockSelect(blockIdx),
+                               UDMA_MODE_PINGPONG,
+                               (void*) (pChannelData->base + UART_O_DR),
+                               pDmaReceiveBuffer->blocks[blockIdx],
+                               UART_DMA_RECEIVE_BLOCK_LEN);
+}
+
+void startDmaReceive(UartChannelData* pChannelData)
+{
+    DmaReceiveBuffer* const pDmaReceiveBuffer = &pChannelData->dmaReceiveBuffer;
+    // arbitration size matches UART_DMA_RECEIVE_BURST_LEN
+    const uint32_t control = UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_8;
+
+    MAP_uDMAChannelAssign(pDmaReceiveBuffer->channel);
+    MAP_uDMAChannelAttributeDisable(pDmaReceiveBuffer->channel,
+                                    UDMA_ATTR_ALTSELECT | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+    // single requests would empty FIFO character by character and receive timeout would never come
+    MAP_uDMAChannelAttributeEnable(pDmaReceiveBuffer->channel, UDMA_ATTR_USEBURST);
+    MAP_uDMAChannelControlSet(pDmaReceiveBuffer->channel | UDMA_PRI_SELECT, control);
+    MAP_uDMAChannelControlSet(pDmaReceiveBuffer->channel | UDMA_ALT_SELECT, control);
+
+    pDmaReceiveBuffer->activeBlockIdx = 0;
+    pDmaReceiveBuffer->processedCharsCount = 0;
+    armDmaReceiveBlock(pChannelData, 0);
+    armDmaReceiveBlock(pChannelData, 1);
+
+    MAP_uDMAChannelEnable(pDmaReceiveBuffer->channel);
+    MAP_UARTDMAEnable(pChannelData->base, UART_DMA_RX);
+}
+
+void receiveDmaBlockCharacters(UartChannelData* pChannelData, uint8_t charsCount)
+{
+    DmaReceiveBuffer* const pDmaReceiveBuffer = &pChannelData->dmaReceiveBuffer;
+    const uint8_t* const pBlock = pDmaReceiveBuffer->blocks[pDmaReceiveBuffer->activeBlockIdx];
+
+    for (uint8_t i = pDmaReceiveBuffer->processedCharsCount; i < charsCount; ++i)
+    {
+        receiveCharacter(pChannelData, pBlock[i]);
+    }
+    pDmaReceiveBuffer->processedCharsCount = charsCount;
+}
+
+void receiveDmaCharacters(UartChannelData* pChannelData)
+{
+    DmaReceiveBuffer* const pDmaReceiveBuffer = &pChannelData->dmaReceiveBuffer;
+
+    // FIFO is read directly at the end, uDMA can't take characters which came before those
+    MAP_UARTDMADisable(pChannelData->base, UART_DMA_RX);
+
+    // filled blocks go in the order uDMA switched between them
+    while (MAP_uDMAChannelModeGet(pDmaReceiveBuffer->channel |
+                                  UARTDmaReceiveBlockSelect(pDmaReceiveBuffer->activeBlockIdx)) == UDMA_MODE_STOP)
+    {
+        receiveDmaBlockCharacters(pChannelData, UART_DMA_RECEIVE_BLOCK_LEN);
+        armDmaReceiveBlock(pChannelData, pDmaReceiveBuffer->activeBlockIdx);
+        pDmaReceiveBuffer->activeBlockIdx ^= 1;
+        pDmaReceiveBuffer->processedCharsCount = 0;
+    }
+
+    // both blocks were filled before interrupt got to them so uDMA stopped the channel
+    if (!MAP_uDMAChannelIsEnabled(pDmaReceiveBuffer->channel))
+    {
+        MAP_uDMAChannelEnable(pDmaReceiveBuffer->channel);
+    }
+
+    // partially filled block and characters below burst size (receive timeout)
+    const uint32_t activeBlock = pDmaReceiveBuffer->channel | UARTDmaReceiveBlockSelect(pDmaReceiveBuffer->activeBlockIdx);
+    const uint32_t remainingCharsCount = MAP_uDMAChannelSizeGet(activeBlock);
+    receiveDmaBlockCharacters(pChannelData, (uint8_t) (UART_DMA_RECEIVE_BLOCK_LEN - remainingCharsCount));
+    receiveFifoCharacters(pChannelData);
+
+    // no burst can complete while UART requests are disabled, completion of the blocks above is acknowledged
+    const uint32_t channelIntMask = UARTDmaChannelIntMask(pDmaReceiveBuffer->channel);
+    if (MAP_uDMAIntStatus() & channelIntMask)
+    {
+        MAP_uDMAIntClear(channelIntMask);
+    }
+
+    MAP_UARTDMAEnable(pChannelData->base, UART_DMA_RX);
+}
+
+#endif
+
+void countReceiveErrors(UartChannelData* pChannelData)
+{
+    // receive status keeps errors until it is cleared so each of them counts at most once per interrupt
+    const uint32_t errors = MAP_UARTRxErrorGet(pChannelData->base);
+
+    if (errors == 0)
+    {
+        return;
+    }
+    if (errors & UART_RXERROR_OVERRUN)
+    {
+        ++pChannelData->health.overrunErrorsCount;
+    }
+    if (errors & UART_RXERROR_FRAMING)
+    {
+        ++pChannelData->health.framingErrorsCount;
+    }
+    MAP_UARTRxErrorClear(pChannelData->base);
+}
+
+void uartReadIntHandler(UartChannelData* pChannelData)
+{
+#ifdef UART_DMA_RECEIVE
+    if (UARTIsDmaReceiveEnabled(pChannelData))
+    {
+        receiveDmaCharacters(pChannelData);
+        countReceiveErrors(pChannelData);
+        return;
     }
+#endif
+    receiveFifoCharacters(pChannelData);
+    countReceiveErrors(pChannelData);
 }
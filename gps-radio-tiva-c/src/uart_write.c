@@ -3,6 +3,10 @@
 
 #include <string.h>
 
+#ifdef UART_DMA_TRANSMIT
+    #include <inc/hw_uart.h>
+#endif
+
 uint16_t advanceUint16Index(uint16_t currentValue, uint16_t maxLen)
 {
     ++currentValue;
@@ -19,11 +23,12 @@ uint16_t getBufferCapacity(const WriteBuffer* pWriteBuffer, uint16_t maxLen)
     const uint16_t start = pWriteBuffer->startIdx;
     const uint16_t end = pWriteBuffer->endIdx;
     
+    // one character is always left free, full buffer would have start == end just like empty one
     if (start == end)
     {
         if (isEmpty)
         {
-            return maxLen;
+            return maxLen - 1;
         }
         else
         {
@@ -32,16 +37,105 @@ uint16_t getBufferCapacity(const WriteBuffer* pWriteBuffer, uint16_t maxLen)
     }
     else if (end > start)
     {
-        return maxLen - (end - start);
+        return maxLen - 1 - (end - start);
     }
     else
     {
-        return end - start;
+        return start - end - 1;
+    }
+}
+
+#ifdef UART_DMA_TRANSMIT
+
+void startDmaTransmit(UartChannelData* pChannelData)
+{
+    const uint32_t channel = pChannelData->dmaTransmit.channel;
+
+    MAP_uDMAChannelAssign(channel);
+    MAP_uDMAChannelAttributeDisable(channel, UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST |
+                                             UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+    // TX FIFO trigger level (1/8) leaves space for the whole burst
+    MAP_uDMAChannelControlSet(channel | UDMA_PRI_SELECT, UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_4);
+}
+
+void transmitDmaSpan(UartChannelData* pChannelData)
+{
+    WriteBuffer* const pWriteBuffer = &pChannelData->writeBuffer;
+    const uint16_t start = pWriteBuffer->startIdx;
+    const uint16_t end = pWriteBuffer->endIdx;
+
+    if (pChannelData->dmaTransmit.transferSize != 0)
+    {
+        return;
+    }
+
+    // UART keeps requesting stopped channel and every request ends up as another pending completion
+    if (start == end && pWriteBuffer->isEmpty)
+    {
+        MAP_UARTDMADisable(pChannelData->base, UART_DMA_TX);
+        return;
+    }
+
+    // span ends at the end of the buffer, the rest goes with the next one
+    const uint16_t size = (end > start) ? (end - start) : (UART_WRITE_BUFFER_MAX_CHARS_LEN - start);
+
+    pChannelData->dmaTransmit.transferSize = size;
+    MAP_uDMAChannelTransferSet(pChannelData->dmaTransmit.channel | UDMA_PRI_SELECT,
+                               UDMA_MODE_BASIC,
+                               &pWriteBuffer->buffer[start],
+                               (void*) (pChannelData->base + UART_O_DR),
+                               size);
+    MAP_uDMAChannelEnable(pChannelData->dmaTransmit.channel);
+    MAP_UARTDMAEnable(pChannelData->base, UART_DMA_TX);
+}
+
+void completeDmaTransmit(UartChannelData* pChannelData)
+{
+    WriteBuffer* const pWriteBuffer = &pChannelData->writeBuffer;
+
+    // completion stays pending on UART interrupt until it is acknowledged, the channel is checked right after
+    const uint32_t channelIntMask = UARTDmaChannelIntMask(pChannelData->dmaTransmit.channel);
+    if (MAP_uDMAIntStatus() & channelIntMask)
+    {
+        MAP_uDMAIntClear(channelIntMask);
+    }
+
+    if (pChannelData->dmaTransmit.transferSize == 0 ||
+        MAP_uDMAChannelModeGet(pChannelData->dmaTransmit.channel | UDMA_PRI_SELECT) != UDMA_MODE_STOP)
+    {
+        return;
+    }
+
+    uint16_t start = pWriteBuffer->startIdx + pChannelData->dmaTransmit.transferSize;
+    if (start >= UART_WRITE_BUFFER_MAX_CHARS_LEN)
+    {
+        start = 0;
     }
+    pWriteBuffer->startIdx = start;
+    if (start == pWriteBuffer->endIdx)
+    {
+        pWriteBuffer->isEmpty = true;
+    }
+    pChannelData->dmaTransmit.transferSize = 0;
+
+    transmitDmaSpan(pChannelData);
 }
 
+#endif
+
 void uartTransmit(UartChannelData* pChannelData)
 {
+#ifdef UART_DMA_TRANSMIT
+    if (UARTIsDmaTransmitEnabled(pChannelData))
+    {
+        // uDMA completion comes on UART interrupt regardless of its mask
+        MAP_IntDisable(pChannelData->interruptId);
+        transmitDmaSpan(pChannelData);
+        MAP_IntEnable(pChannelData->interruptId);
+        return;
+    }
+#endif
+
     UARTTxInterruptDisable(pChannelData);
     
     while(UARTSpaceAvailable(pChannelData) && 
@@ -72,6 +166,7 @@ bool write(uint8_t channel, uint8_t character)
     if ((!pChannelData->writeBuffer.isEmpty && pChannelData->writeBuffer.startIdx == pChannelData->writeBuffer.endIdx) ||
         getBufferCapacity(&pChannelData->writeBuffer, UART_WRITE_BUFFER_MAX_CHARS_LEN) < 1)
     {
+        ++pChannelData->health.rejectedWritesCount;
         return false;
     }
 
@@ -96,6 +191,7 @@ bool writeMessageBuffer(uint8_t channel, const uint8_t* pBuffer, uint8_t size)
     if ((!pChannelData->writeBuffer.isEmpty && pChannelData->writeBuffer.startIdx == pChannelData->writeBuffer.endIdx) ||
         getBufferCapacity(&pChannelData->writeBuffer, UART_WRITE_BUFFER_MAX_CHARS_LEN) < size)
     {
+        ++pChannelData->health.rejectedWritesCount;
         return false;
     }
 
@@ -112,6 +208,14 @@ bool writeMessageBuffer(uint8_t channel, const uint8_t* pBuffer, uint8_t size)
 
 void uartWriteIntHandler(UartChannelData* pChannelData)
 {
+#ifdef UART_DMA_TRANSMIT
+    if (UARTIsDmaTransmitEnabled(pChannelData))
+    {
+        completeDmaTransmit(pChannelData);
+        return;
+    }
+#endif
+
     bool disableInterrupt = false;
 
     if (pChannelData->writeBuffer.isEmpty && pChannelData->writeBuffer.startIdx == pChannelData->writeBuffer.endIdx)
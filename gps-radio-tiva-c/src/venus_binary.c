@@ -0,0 +1,261 @@
+#include "venus_binary_impl.h"
+
+#include <math.h>
+#include <string.h>
+
+// longer length means start sequence was found inside other data, waiting for it would drop following frames
+#define VENUS_MAX_SKIPPED_PAYLOAD_LEN 1024
+
+#define VENUS_RADIANS_PER_DEGREE_E7   (3.14159265f / 180.0f / GPS_DEGREES_E7_PER_DEGREE)
+
+void initializeVenusBinaryParser(VenusBinaryParser* pParser)
+{
+    memset(pParser, 0, sizeof(VenusBinaryParser));
+}
+
+uint16_t createVenusFrame(const uint8_t* pPayload, uint16_t payloadLen, uint8_t* pFrame)
+{
+    uint8_t checksum = 0;
+
+    pFrame[0] = VENUS_START_1;
+    pFrame[1] = VENUS_START_2;
+    pFrame[2] = (uint8_t) (payloadLen >> 8);
+    pFrame[3] = (uint8_t) payloadLen;
+
+    for (uint16_t i = 0; i < payloadLen; ++i)
+    {
+        pFrame[4 + i] = pPayload[i];
+        checksum ^= pPayload[i];
+    }
+
+    pFrame[4 + payloadLen] = checksum;
+    pFrame[5 + payloadLen] = VENUS_END_1;
+    pFrame[6 + payloadLen] = VENUS_END_2;
+
+    return payloadLen + VENUS_FRAME_OVERHEAD_LEN;
+}
+
+uint8_t createVenusBinaryOutputFrame(uint8_t* pFrame)
+{
+    static const uint8_t payload[] = { VENUS_CONFIGURE_MESSAGE_TYPE_ID, VENUS_MESSAGE_TYPE_BINARY, VENUS_ATTRIBUTES_SRAM };
+
+    return (uint8_t) createVenusFrame(payload, sizeof(payload), pFrame);
+}
+
+void completeVenusFrame(VenusBinaryParser* pParser)
+{
+    switch (pParser->payload[0])
+    {
+        case VENUS_NAVIGATION_DATA_ID:
+        {
+            if (pParser->payloadLen == VENUS_NAVIGATION_DATA_LEN)
+            {
+                const uint8_t publishedNavigationDataIdx = pParser->publishedNavigationDataIdx ^ 1;
+                memcpy(pParser->publishedNavigationData[publishedNavigationDataIdx], pParser->payload, VENUS_NAVIGATION_DATA_LEN);
+                pParser->publishedNavigationDataIdx = publishedNavigationDataIdx;
+                ++pParser->publishedCount;
+                pParser->isBinaryOutputConfirmed = true;
+            }
+            break;
+        }
+        case VENUS_ACK_ID:
+        {
+            if (pParser->payloadLen >= 2 && pParser->payload[1] == VENUS_CONFIGURE_MESSAGE_TYPE_ID)
+            {
+                pParser->isBinaryOutputConfirmed = true;
+            }
+            break;
+        }
+        default:
+        {
+            // NACK is left to configuration retries
+            break;
+        }
+    }
+}
+
+bool rejectVenusFrame(VenusBinaryParser* pParser)
+{
+    ++pParser->rejectedCount;
+    pParser->state = VFS_WAITING_FOR_START_1;
+    return false;
+}
+
+bool parseVenusBinaryByte(VenusBinaryParser* pParser, uint8_t c)
+{
+    switch (pParser->state)
+    {
+        case VFS_WAITING_FOR_START_1:
+        {
+            if (c == VENUS_START_1)
+            {
+                pParser->state = VFS_WAITING_FOR_START_2;
+            }
+            break;
+        }
+        case VFS_WAITING_FOR_START_2:
+        {
+            if (c == VENUS_START_2)
+            {
+                pParser->state = VFS_LENGTH_HIGH;
+            }
+            else if (c != VENUS_START_1)
+            {
+                pParser->state = VFS_WAITING_FOR_START_1;
+            }
+            break;
+        }
+        case VFS_LENGTH_HIGH:
+        {
+            pParser->payloadLen = (uint16_t) (c << 8);
+            pParser->state = VFS_LENGTH_LOW;
+            break;
+        }
+        case VFS_LENGTH_LOW:
+        {
+            pParser->payloadLen |= c;
+            if (pParser->payloadLen == 0 || pParser->payloadLen > VENUS_MAX_SKIPPED_PAYLOAD_LEN)
+            {
+                return rejectVenusFrame(pParser);
+            }
+            pParser->payloadIdx = 0;
+            pParser->checksum = 0;
+            pParser->state = VFS_PAYLOAD;
+            break;
+        }
+        case VFS_PAYLOAD:
+        {
+            if (pParser->payloadIdx < VENUS_MAX_PAYLOAD_LEN)
+            {
+                pParser->payload[pParser->payloadIdx] = c;
+            }
+            pParser->checksum ^= c;
+            if (++pParser->payloadIdx == pParser->payloadLen)
+            {
+                pParser->state = VFS_CHECKSUM;
+            }
+            break;
+        }
+        case VFS_CHECKSUM:
+        {
+            if (c != pParser->checksum)
+            {
+                return rejectVenusFrame(pParser);
+            }
+            pParser->state = VFS_END_1;
+            break;
+        }
+        case VFS_END_1:
+        {
+            if (c != VENUS_END_1)
+            {
+                return rejectVenusFrame(pParser);
+            }
+            pParser->state = VFS_END_2;
+            break;
+        }
+        case VFS_END_2:
+        {
+            if (c != VENUS_END_2)
+            {
+                return rejectVenusFrame(pParser);
+            }
+            pParser->state = VFS_WAITING_FOR_START_1;
+            if (pParser->payloadLen <= VENUS_MAX_PAYLOAD_LEN)
+            {
+                completeVenusFrame(pParser);
+            }
+            return true;
+        }
+        default:
+        {
+            pParser->state = VFS_WAITING_FOR_START_1;
+            break;
+        }
+    }
+
+    return false;
+}
+
+void ecefVelocityToEastNorth(float vx, float vy, float vz, float latitudeRadians, float longitudeRadians, float* pEast, float* pNorth)
+{
+    const float sinLatitude = sinf(latitudeRadians);
+    const float cosLatitude = cosf(latitudeRadians);
+    const float sinLongitude = sinf(longitudeRadians);
+    const float cosLongitude = cosf(longitudeRadians);
+
+    *pEast = -sinLongitude * vx + cosLongitude * vy;
+    *pNorth = -sinLatitude * cosLongitude * vx - sinLatitude * sinLongitude * vy + cosLatitude * vz;
+}
+
+bool decodeVenusNavigationData(const uint8_t* pPayload, GpsData* pResult)
+{
+    const uint8_t fixMode = pPayload[VENUS_NAV_FIX_MODE];
+
+    if (fixMode > VFM_3D_DGPS)
+    {
+        return false;
+    }
+
+    // NMEA fix modes are 1 - no fix, 2 - 2D, 3 - 3D
+    pResult->gpgsaData.fixMode = fixMode == VFM_3D_DGPS ? 3 : fixMode + 1;
+    pResult->gpgsaData.pdop = readBigEndianUint16(pPayload + VENUS_NAV_PDOP);
+    pResult->gpgsaData.hdop = readBigEndianUint16(pPayload + VENUS_NAV_HDOP);
+    pResult->gpgsaData.vdop = readBigEndianUint16(pPayload + VENUS_NAV_VDOP);
+
+    if (fixMode == VFM_NO_FIX)
+    {
+        // same as GPGGA without fix, the last position stays
+        return true;
+    }
+
+    const int32_t latitude = (int32_t) readBigEndianUint32(pPayload + VENUS_NAV_LATITUDE);
+    const int32_t longitude = (int32_t) readBigEndianUint32(pPayload + VENUS_NAV_LONGITUDE);
+    const int32_t altitudeMslCentimeters = (int32_t) readBigEndianUint32(pPayload + VENUS_NAV_MSL_ALTITUDE);
+    GpggaData* const pGpggaData = &pResult->gpggaData;
+
+    gpsWeekTimeToUtc(readBigEndianUint16(pPayload + VENUS_NAV_GPS_WEEK),
+                     readBigEndianUint32(pPayload + VENUS_NAV_TIME_OF_WEEK),
+                     GPS_UTC_LEAP_SECONDS,
+                     &pGpggaData->utcTime,
+                     &pResult->utcDate);
+    degreesE7ToAngularCoordinate(latitude, true, &pGpggaData->latitude);
+    degreesE7ToAngularCoordinate(longitude, false, &pGpggaData->longitude);
+    // W5F1 meters can't go below sea level
+    pGpggaData->altitudeMslMeters = altitudeMslCentimeters > 0 ? (fixedPointW5F1_t) (altitudeMslCentimeters + 5) / 10 : 0;
+    pGpggaData->fixType = fixMode == VFM_3D_DGPS ? GPSFT_DGPS : GPSFT_GPS;
+    pGpggaData->numberOfSattelitesInUse = pPayload[VENUS_NAV_SATELLITES_COUNT];
+
+    float east, north;
+    ecefVelocityToEastNorth((int32_t) readBigEndianUint32(pPayload + VENUS_NAV_ECEF_VX) / 100.0f,
+                            (int32_t) readBigEndianUint32(pPayload + VENUS_NAV_ECEF_VY) / 100.0f,
+                            (int32_t) readBigEndianUint32(pPayload + VENUS_NAV_ECEF_VZ) / 100.0f,
+                            latitude * VENUS_RADIANS_PER_DEGREE_E7,
+                            longitude * VENUS_RADIANS_PER_DEGREE_E7,
+                            &east,
+                            &north);
+    horizontalVelocityToGpvtg(east, north, &pResult->gpvtgData);
+
+    if (pGpggaData->latitude.isValid && pGpggaData->longitude.isValid)
+    {
+        pResult->isValid = true;
+    }
+
+    return true;
+}
+
+bool readVenusGpsData(VenusBinaryParser* pParser, GpsData* pResult)
+{
+    const uint32_t publishedCount = pParser->publishedCount;
+
+    if (publishedCount == pParser->readCount)
+    {
+        return false;
+    }
+
+    uint8_t payload[VENUS_NAVIGATION_DATA_LEN];
+    pParser->readCount = publishedCount;
+    memcpy(payload, pParser->publishedNavigationData[pParser->publishedNavigationDataIdx], VENUS_NAVIGATION_DATA_LEN);
+
+    return decodeVenusNavigationData(payload, pResult);
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+/*
+ * SkyTraq Venus binary protocol.
+ *
+ * Frames are <0xA0 0xA1><payload length, 2 bytes><payload><checksum><0x0D 0x0A>, payload starts with message id,
+ * checksum is XOR of payload bytes and multi-byte values are big endian. Frames are parsed byte by byte in UART
+ * receive interrupt, navigation data payload is published at the end of frame and decoded by main loop with
+ * readVenusGpsData().
+ */
+
+#include "nmea_messages.h"
+
+#define VENUS_START_1                      0xA0
+#define VENUS_START_2                      0xA1
+#define VENUS_END_1                        0x0D
+#define VENUS_END_2                        0x0A
+#define VENUS_FRAME_OVERHEAD_LEN           7
+
+#define VENUS_CONFIGURE_MESSAGE_TYPE_ID    0x09
+#define VENUS_MESSAGE_TYPE_BINARY          0x02
+#define VENUS_ATTRIBUTES_SRAM              0x00 // power cycle brings NMEA output back
+#define VENUS_ACK_ID                       0x83
+#define VENUS_NACK_ID                      0x84
+#define VENUS_NAVIGATION_DATA_ID           0xA8
+#define VENUS_NAVIGATION_DATA_LEN          59
+
+// longer frames (receiver version, almanac, ...) are checked and skipped
+#define VENUS_MAX_PAYLOAD_LEN              VENUS_NAVIGATION_DATA_LEN
+
+#define VENUS_BINARY_OUTPUT_FRAME_LEN      (3 + VENUS_FRAME_OVERHEAD_LEN)
+
+typedef enum VENUS_FRAME_STATE_t
+{
+    VFS_WAITING_FOR_START_1 = 0,
+    VFS_WAITING_FOR_START_2,
+    VFS_LENGTH_HIGH,
+    VFS_LENGTH_LOW,
+    VFS_PAYLOAD,
+    VFS_CHECKSUM,
+    VFS_END_1,
+    VFS_END_2,
+} VENUS_FRAME_STATE;
+
+typedef struct VenusBinaryParser_t
+{
+    VENUS_FRAME_STATE state;
+    uint8_t checksum;
+    uint16_t payloadLen;
+    uint16_t payloadIdx;
+    uint8_t payload[VENUS_MAX_PAYLOAD_LEN];
+
+    // navigation data is published to the slot which isn't being read, frames come once a second
+    uint8_t publishedNavigationData[2][VENUS_NAVIGATION_DATA_LEN];
+    volatile uint8_t publishedNavigationDataIdx;
+    volatile uint32_t publishedCount;
+    uint32_t readCount;
+
+    volatile bool isBinaryOutputConfirmed; // receiver acknowledged configuration or sends binary messages already
+    volatile uint32_t rejectedCount;       // frames with wrong checksum or end
+} VenusBinaryParser;
+
+void initializeVenusBinaryParser(VenusBinaryParser* pParser);
+
+// to be called from UART receive interrupt, returns true at the end of frame with valid checksum
+bool parseVenusBinaryByte(VenusBinaryParser* pParser, uint8_t c);
+
+// to be called from main loop, returns false if no navigation data was published since the last call
+bool readVenusGpsData(VenusBinaryParser* pParser, GpsData* pResult);
+
+// frame which switches receiver output from NMEA to binary messages, returns its length
+uint8_t createVenusBinaryOutputFrame(uint8_t* pFrame);
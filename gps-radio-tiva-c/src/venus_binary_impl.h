@@ -0,0 +1,48 @@
+#pragma once
+
+#include "venus_binary.h"
+#include "gps_conversions.h"
+
+// offsets of navigation data fields in payload (after message id)
+#define VENUS_NAV_FIX_MODE              1
+#define VENUS_NAV_SATELLITES_COUNT      2
+#define VENUS_NAV_GPS_WEEK              3
+#define VENUS_NAV_TIME_OF_WEEK          5  // 1/100 s
+#define VENUS_NAV_LATITUDE              9  // 1/10^7 degree
+#define VENUS_NAV_LONGITUDE             13
+#define VENUS_NAV_ELLIPSOID_ALTITUDE    17 // cm
+#define VENUS_NAV_MSL_ALTITUDE          21
+#define VENUS_NAV_GDOP                  25 // 1/100
+#define VENUS_NAV_PDOP                  27
+#define VENUS_NAV_HDOP                  29
+#define VENUS_NAV_VDOP                  31
+#define VENUS_NAV_TDOP                  33
+#define VENUS_NAV_ECEF_X                35 // cm
+#define VENUS_NAV_ECEF_Y                39
+#define VENUS_NAV_ECEF_Z                43
+#define VENUS_NAV_ECEF_VX               47 // cm/s
+#define VENUS_NAV_ECEF_VY               51
+#define VENUS_NAV_ECEF_VZ               55
+
+typedef enum VENUS_FIX_MODE_t
+{
+    VFM_NO_FIX  = 0,
+    VFM_2D      = 1,
+    VFM_3D      = 2,
+    VFM_3D_DGPS = 3,
+} VENUS_FIX_MODE;
+
+// writes frame around payload, returns frame length
+uint16_t createVenusFrame(const uint8_t* pPayload, uint16_t payloadLen, uint8_t* pFrame);
+
+// returns false so it can end byte parsing
+bool rejectVenusFrame(VenusBinaryParser* pParser);
+
+// frame with valid checksum is received (interrupt)
+void completeVenusFrame(VenusBinaryParser* pParser);
+
+// rotates ECEF velocity to local east and north at the given position
+void ecefVelocityToEastNorth(float vx, float vy, float vz, float latitudeRadians, float longitudeRadians, float* pEast, float* pNorth);
+
+// navigation data without fix updates fix mode and DOPs only, returns false for unknown fix mode
+bool decodeVenusNavigationData(const uint8_t* pPayload, GpsData* pResult);